@@ -36,6 +36,21 @@ namespace MassSpringDamper::Surrogate {
 
     typedef Eigen::Vector<C, Eigen::Dynamic> VectorXC;
 
+    typedef Eigen::SparseMatrix<R> SparseMatrixXR;
+    typedef Eigen::SparseMatrix<C> SparseMatrixXC;
+
+    typedef MonteCarlo::StreamingStatistics<Z,R,C> StreamingStatistics;
+
+    /**
+      * @brief 
+      * Linear solvers to compute coefficients of intrusive PCE. 
+      * DenseLU assembles the full Galerkin system, SparseLU only stores 
+      * blocks with non-zero expected value of Hermite triples. 
+      * MatrixFree never assembles the system, it applies sum_k T_k x K_k 
+      * inside BiCGSTAB preconditioned by the mean dynamic stiffness. 
+      */
+    enum class GalerkinSolver { DenseLU, SparseLU, MatrixFree };
+
     /**
       * @class DirectMCS 
       * 
@@ -48,13 +63,54 @@ namespace MassSpringDamper::Surrogate {
         VectorR Dampers_; 
         VectorR Springs_; 
 
+        // chain of the default parameters, assembles sample bands 
+        AnalyticalModel SDModel_; 
+
         VectorZ Indices_; 
 
+        // samples per batch of the SoA tridiagonal solver, 0 for per sample 
+        Z BatchSize_; 
+
+        // OpenMP threads, 0 for all available 
+        Z Threads_; 
+
+        // points per tile in AccumulateResponse, 0 for a single tile 
+        Z TileSize_; 
+
         R Omega_; 
         Z Dim_; 
 
         public: 
 
+        /**
+          * @brief 
+          * Scratch buffers of @ref ComputeResponse. Buffers grow on first use 
+          * and are reused by later calls, so a sampling loop with at most 
+          * as many points per call allocates nothing after the first call. 
+          * One set of solver buffers per thread. 
+          */
+        struct Workspace {
+
+            VectorR Args; 
+            VectorR RealBasis; 
+            VectorC Basis; 
+
+            BasisFunctions::HermiteScratch<R,R> RealScratch; 
+            BasisFunctions::HermiteScratch<R,C> Scratch; 
+
+            VectorR RandomMasses; 
+            VectorR RandomDampers; 
+            VectorR RandomSprings; 
+            VectorC RandomForces; 
+
+            // SoA bands and right hand sides of the batched solver 
+            std::vector<VectorR> Lanes; 
+
+            // bands of the dynamic stiffness of a sample 
+            std::vector<VectorC> Bands; 
+
+        };
+
         /**
           * @brief 
           * Create PCE model for given SD model and angular velocity 
@@ -98,6 +154,161 @@ namespace MassSpringDamper::Surrogate {
 
         ) const; 
 
+        /**
+          * @brief 
+          * Solve samples in batches, the tridiagonal systems of a batch are 
+          * stored as structure-of-arrays and solved together by the Thomas 
+          * algorithm, one sample per SIMD lane. 
+          * 
+          * @param BatchSize number of samples per batch, 0 for per-sample 
+          *                  pivoted tridiagonal solve (default) 
+          */
+        void SetBatchSize ( const Z BatchSize );
+
+        /**
+          * @brief 
+          * Set number of OpenMP threads solving samples. Samples or batches 
+          * are statically split into fixed chunks writing disjoint columns, 
+          * so results are bit-identical for any number of threads. 
+          * Ignored when compiled without OpenMP. 
+          * 
+          * @param Threads number of threads, 0 for all available, default 1 
+          */
+        void SetThreads ( const Z Threads );
+
+        /**
+          * @brief 
+          * Set number of points solved at once by AccumulateResponse 
+          * 
+          * @param TileSize number of points per tile, 0 for a single tile 
+          */
+        void SetTileSize ( const Z TileSize );
+
+        /**
+          * @brief 
+          * Compute response for real random inputs. Basis functions are 
+          * evaluated as a real matrix, halving memory of the basis. 
+          */
+        VectorC ComputeResponse ( 
+
+            const VectorR& X, 
+            const VectorC& Load, 
+            const VectorR& MassBasisCoeffs, 
+            const VectorR& DamperBasisCoeffs, 
+            const VectorR& SpringBasisCoeffs, 
+            const VectorC& ForceBasisCoeffs 
+
+        ) const; 
+
+        /**
+          * @brief 
+          * Compute responses into a caller buffer, temporaries are kept in 
+          * Work so repeated calls allocate nothing after warm-up. Results 
+          * are identical to the overloads returning a vector. 
+          * 
+          * @param Response output of nDOFs x nPoints responses 
+          * @param Work     reusable scratch buffers 
+          */
+        void ComputeResponse ( 
+
+            const VectorC& X, 
+            const VectorC& Load, 
+            const VectorR& MassBasisCoeffs, 
+            const VectorR& DamperBasisCoeffs, 
+            const VectorR& SpringBasisCoeffs, 
+            const VectorC& ForceBasisCoeffs, 
+            C* Response, 
+            Workspace& Work 
+
+        ) const; 
+
+        void ComputeResponse ( 
+
+            const VectorR& X, 
+            const VectorC& Load, 
+            const VectorR& MassBasisCoeffs, 
+            const VectorR& DamperBasisCoeffs, 
+            const VectorR& SpringBasisCoeffs, 
+            const VectorC& ForceBasisCoeffs, 
+            C* Response, 
+            Workspace& Work 
+
+        ) const; 
+
+        /**
+          * @brief 
+          * Feed responses into streaming statistics one tile of points at 
+          * a time, the full response vector is never stored. 
+          * 
+          * @param Stats accumulator with nDOFs responses per sample 
+          */
+        void AccumulateResponse ( 
+
+            const VectorC& X, 
+            const VectorC& Load, 
+            const VectorR& MassBasisCoeffs, 
+            const VectorR& DamperBasisCoeffs, 
+            const VectorR& SpringBasisCoeffs, 
+            const VectorC& ForceBasisCoeffs, 
+            StreamingStatistics& Stats 
+
+        ) const; 
+
+        void AccumulateResponse ( 
+
+            const VectorR& X, 
+            const VectorC& Load, 
+            const VectorR& MassBasisCoeffs, 
+            const VectorR& DamperBasisCoeffs, 
+            const VectorR& SpringBasisCoeffs, 
+            const VectorC& ForceBasisCoeffs, 
+            StreamingStatistics& Stats 
+
+        ) const; 
+
+        private: 
+
+        template < typename T > 
+        /**
+          * @private 
+          * 
+          * @brief 
+          * Solve tiles of samples and feed them into Stats 
+          */
+        void AccumulateTiles ( 
+
+            const std::vector<T>& X, 
+            const VectorC& Load, 
+            const VectorR& MassBasisCoeffs, 
+            const VectorR& DamperBasisCoeffs, 
+            const VectorR& SpringBasisCoeffs, 
+            const VectorC& ForceBasisCoeffs, 
+            StreamingStatistics& Stats 
+
+        ) const; 
+
+        template < typename T > 
+        /**
+          * @private 
+          * 
+          * @brief 
+          * Solve analytical model for each of nPoints samples into Result, 
+          * T is either R or C 
+          */
+        void SolveSamples ( 
+
+            const T* X, 
+            const Z nPoints, 
+            const VectorC& Load, 
+            const VectorR& MassBasisCoeffs, 
+            const VectorR& DamperBasisCoeffs, 
+            const VectorR& SpringBasisCoeffs, 
+            const VectorC& ForceBasisCoeffs, 
+            C* Result, 
+            Workspace& Work 
+
+        ) const; 
+
     }; // DirectMCS 
 
     /**
@@ -115,11 +326,42 @@ namespace MassSpringDamper::Surrogate {
         VectorZ Indices_; 
         VectorC Coeffs_; 
 
+        // reused by every training with the same indices 
+        BasisFunctions::TripleProductTensor<Z,R> Triples_; 
+
+        GalerkinSolver Solver_; 
+
+        R Tolerance_; 
+        Z MaxIterations_; 
+
+        // points per tile in ComputeResponse, 0 evaluates all at once 
+        Z TileSize_; 
+
         R Omega_; 
         Z Dim_; 
 
+        // angular velocities and coefficients of the last TrainSweep 
+        VectorR Omegas_; 
+        VectorC SweepCoeffs_; 
+
         public: 
 
+        /**
+          * @brief 
+          * Scratch buffers of @ref ComputeResponse, reused by later calls 
+          * so evaluating tiles in a loop allocates nothing after warm-up. 
+          */
+        struct Workspace {
+
+            VectorR Args; 
+            VectorR RealBasis; 
+            VectorC Basis; 
+
+            BasisFunctions::HermiteScratch<R,R> RealScratch; 
+            BasisFunctions::HermiteScratch<R,C> Scratch; 
+
+        };
+
         Z Dim () const { return Dim_; } 
 
         /**
@@ -148,7 +390,35 @@ namespace MassSpringDamper::Surrogate {
 
         /**
           * @brief 
-          * Compute coefficients of basis functions 
+          * Choose linear solver used in training, default is DenseLU 
+          * 
+          * @param Solver DenseLU, SparseLU or MatrixFree Galerkin solver 
+          */
+        void SetSolver ( const GalerkinSolver Solver );
+
+        /**
+          * @brief 
+          * Set stopping criteria of the MatrixFree solver 
+          * 
+          * @param Tolerance     relative residual norm to stop iterations 
+          * @param MaxIterations maximum number of BiCGSTAB iterations 
+          */
+        void SetTolerance ( const R Tolerance, const Z MaxIterations );
+
+        /**
+          * @brief 
+          * Evaluate responses in tiles of points. The basis functions of a 
+          * tile are contracted with the coefficients right away, so peak 
+          * memory is O(TileSize x nBasis) regardless of number of points. 
+          * 
+          * @param TileSize number of points per tile, 0 for a single tile 
+          */
+        void SetTileSize ( const Z TileSize );
+
+        /**
+          * @brief 
+          * Compute coefficients of basis functions, discards the 
+          * coefficients of a previous TrainSweep 
           * 
           * @param Load harmonic load vector 
           */
@@ -162,6 +432,40 @@ namespace MassSpringDamper::Surrogate {
 
         ); 
 
+        /**
+          * @brief 
+          * Compute coefficients at several angular velocities. Triples and 
+          * the Galerkin mass, damping and stiffness operators are assembled 
+          * once, each frequency only forms K - w^2 M + iwC and solves it. 
+          * SparseLU analyzes the shared sparsity pattern once. Afterwards 
+          * the first frequency is selected, see SelectFrequency. 
+          * 
+          * @param Omegas    angular velocities of harmonic load 
+          * @param WarmStart start MatrixFree iterations from coefficients of 
+          *                  the previous frequency, Omegas should be sorted 
+          */
+        void TrainSweep ( 
+
+            const VectorR& Omegas, 
+            const VectorC& Load, 
+            const VectorR& MassBasisCoeffs, 
+            const VectorR& DamperBasisCoeffs, 
+            const VectorR& SpringBasisCoeffs, 
+            const VectorC& ForceBasisCoeffs, 
+            const bool WarmStart = false 
+
+        ); 
+
+        /**
+          * @brief 
+          * Use coefficients of the w-th frequency of the last TrainSweep in 
+          * ComputeResponse, Statistics and SensitivityIndices. Train still 
+          * uses the angular velocity given to the constructor. 
+          */
+        void SelectFrequency ( const Z w );
+
+        const VectorR& Frequencies () const { return Omegas_; } 
+
         /**
           * @brief 
           * Approximate response of analytical model for a given random inputs 
@@ -176,6 +480,175 @@ namespace MassSpringDamper::Surrogate {
           */
         VectorC ComputeResponse ( const VectorC& Load ) const;
 
+        /**
+          * @brief 
+          * Approximate response for real random inputs. Basis functions are 
+          * evaluated as a real matrix and combined by a real x complex GEMM. 
+          * 
+          * @param X random inputs { Point1, Point2, ... } 
+          * 
+          * @return approximate displacement vector 
+          */
+        VectorC ComputeResponse ( const VectorR& X ) const;
+
+        /**
+          * @brief 
+          * Approximate responses into a caller buffer, temporaries are kept 
+          * in Work. Results are identical to the overloads returning a vector. 
+          * 
+          * @param X        random inputs { Point1, Point2, ... } 
+          * @param Response output of nDOFs x nPoints responses 
+          * @param Work     reusable scratch buffers 
+          */
+        void ComputeResponse ( 
+            const VectorC& X, C* Response, Workspace& Work 
+        ) const;
+
+        void ComputeResponse ( 
+            const VectorR& X, C* Response, Workspace& Work 
+        ) const;
+
+        /**
+          * @brief 
+          * Feed approximate responses into streaming statistics one tile of 
+          * points at a time (see SetTileSize), the full response vector is 
+          * never stored. 
+          * 
+          * @param X     random inputs { Point1, Point2, ... } 
+          * @param Stats accumulator with nDOFs responses per sample 
+          */
+        void AccumulateResponse ( 
+            const VectorC& X, StreamingStatistics& Stats 
+        ) const;
+
+        void AccumulateResponse ( 
+            const VectorR& X, StreamingStatistics& Stats 
+        ) const;
+
+        /**
+          * @brief 
+          * Moments of the trained expansion in closed form. The basis is 
+          * orthonormal, so the mean is the coefficient of the constant 
+          * basis function and the variance E|u - mean|^2 is the sum of 
+          * squared magnitudes of the other coefficients, O(nBasis x nDOFs). 
+          * 
+          * @return { mean, variance } per dof 
+          */
+        std::pair<VectorC, VectorR> Statistics () const;
+
+        /**
+          * @brief 
+          * Sobol indices of each random input from the trained coefficients. 
+          * First order indices sum the variance of basis functions that only 
+          * depend on that input, total indices of all that depend on it. 
+          * 
+          * @param Total compute total instead of first order indices 
+          * 
+          * @return indices { Input1 of all dofs, Input2 of all dofs, ... }, 
+          *         zero for dofs without variance 
+          */
+        VectorR SensitivityIndices ( const bool Total = false ) const;
+
+        private: 
+
+        template < typename T > 
+        /**
+          * @private 
+          * 
+          * @brief 
+          * Evaluate tiles of points and feed them into Stats 
+          */
+        void AccumulateTiles ( 
+            const std::vector<T>& X, StreamingStatistics& Stats 
+        ) const;
+
+        /**
+          * @private 
+          * 
+          * @brief 
+          * Evaluate nPoints points into Response, one tile at a time 
+          */
+        void EvaluateTiles ( 
+            const R* X, const Z nPoints, C* Response, Workspace& Work 
+        ) const;
+
+        void EvaluateTiles ( 
+            const C* X, const Z nPoints, C* Response, Workspace& Work 
+        ) const;
+
+        /**
+          * @private 
+          * 
+          * @brief 
+          * Slice k of the cached triple tensor as sparse matrix T_k 
+          */
+        SparseMatrixXR GalerkinTriples ( const Z k ) const;
+
+        /**
+          * @private 
+          * 
+          * @brief 
+          * Cache triples if needed, return T_k of each Galerkin term. 
+          * Term 0 is deterministic, term k+1 belongs to random basis k. 
+          */
+        std::vector<SparseMatrixXR> GalerkinTerms ( const Z nRandomBasis );
+
+        /**
+          * @private 
+          * 
+          * @brief 
+          * Modified force vector of deterministic and random loads 
+          */
+        VectorXC GalerkinForce ( 
+            const VectorC& Load, const VectorC& ForceBasisCoeffs 
+        ) const;
+
+        /**
+          * @private 
+          * 
+          * @brief 
+          * Zero-valued sparsity pattern of sum_k ( T_k x B ) for tridiagonal 
+          * blocks B. Holds exactly the final non-zeros, so entries of all k 
+          * are summed in place instead of as duplicated triplets. 
+          */
+        SparseMatrixXR GalerkinPattern ( 
+            const std::vector<SparseMatrixXR>& Triples 
+        ) const;
+
+        /**
+          * @private 
+          */
+        void SolveDense ( 
+
+            const std::vector<SparseMatrixXR>& Triples, 
+            const std::vector<MatrixXC>& Stiffnesses, 
+            const VectorXC& Force 
+
+        );
+
+        /**
+          * @private 
+          */
+        void SolveSparse ( 
+
+            const std::vector<SparseMatrixXR>& Triples, 
+            const std::vector<MatrixXC>& Stiffnesses, 
+            const VectorXC& Force 
+
+        );
+
+        /**
+          * @private 
+          */
+        void SolveMatrixFree ( 
+
+            const std::vector<SparseMatrixXR>& Triples, 
+            const std::vector<MatrixXC>& Stiffnesses, 
+            const VectorXC& Force, 
+            const bool WarmStart = false 
+
+        );
+
     }; // IntrusivePCE 
 
 
@@ -28,6 +28,8 @@ namespace MassSpringDamper::Surrogate {
         Masses_ ( Masses ), 
         Dampers_ ( Dampers ), 
         Springs_ ( Springs ), 
+        SDModel_ ( Masses, Dampers, Springs ), 
+        BatchSize_ ( 0 ), Threads_ ( 1 ), TileSize_ ( 0 ), 
         Omega_( Omega ), Dim_( Dim ) {}
 
 } // Mass Spring Damper direct MCS constructor 
@@ -50,6 +52,39 @@ namespace MassSpringDamper::Surrogate {
 } // Mass Spring Damper direct MCS set indices 
 
 
+namespace MassSpringDamper::Surrogate {
+
+    void DirectMCS::SetBatchSize ( const Z BatchSize ) {
+
+        BatchSize_ = BatchSize;
+
+    }
+
+} // Mass Spring Damper direct MCS set batch size 
+
+
+namespace MassSpringDamper::Surrogate {
+
+    void DirectMCS::SetThreads ( const Z Threads ) {
+
+        Threads_ = Threads;
+
+    }
+
+} // Mass Spring Damper direct MCS set threads 
+
+
+namespace MassSpringDamper::Surrogate {
+
+    void DirectMCS::SetTileSize ( const Z TileSize ) {
+
+        TileSize_ = TileSize;
+
+    }
+
+} // Mass Spring Damper direct MCS set tile size 
+
+
 namespace MassSpringDamper::Surrogate {
 
     VectorC DirectMCS::ComputeResponse (
@@ -63,23 +98,279 @@ namespace MassSpringDamper::Surrogate {
 
     ) const {
 
-        AnalyticalModel SDModel_ ( Masses_, Dampers_, Springs_ );
+        VectorC Result ( Masses_.size() * ( X.size() / Dim_ ) );
+
+        Workspace Work;
+
+        ComputeResponse ( 
+
+            X, Load, 
+            MassBasisCoeffs, DamperBasisCoeffs, 
+            SpringBasisCoeffs, ForceBasisCoeffs, 
+            Result.data(), Work 
+
+        );
+
+        return Result;
+
+    }
+
+
+    VectorC DirectMCS::ComputeResponse (
+
+        const VectorR& X, 
+        const VectorC& Load, 
+        const VectorR& MassBasisCoeffs, 
+        const VectorR& DamperBasisCoeffs, 
+        const VectorR& SpringBasisCoeffs, 
+        const VectorC& ForceBasisCoeffs 
+
+    ) const {
+
+        VectorC Result ( Masses_.size() * ( X.size() / Dim_ ) );
+
+        Workspace Work;
+
+        ComputeResponse ( 
+
+            X, Load, 
+            MassBasisCoeffs, DamperBasisCoeffs, 
+            SpringBasisCoeffs, ForceBasisCoeffs, 
+            Result.data(), Work 
+
+        );
+
+        return Result;
+
+    }
+
+
+    void DirectMCS::ComputeResponse (
+
+        const VectorC& X, 
+        const VectorC& Load, 
+        const VectorR& MassBasisCoeffs, 
+        const VectorR& DamperBasisCoeffs, 
+        const VectorR& SpringBasisCoeffs, 
+        const VectorC& ForceBasisCoeffs, 
+        C* Response, 
+        Workspace& Work 
+
+    ) const {
+
+        SolveSamples<C> ( 
+
+            X.data(), X.size() / Dim_, Load, 
+            MassBasisCoeffs, DamperBasisCoeffs, 
+            SpringBasisCoeffs, ForceBasisCoeffs, 
+            Response, Work 
+
+        );
+
+    }
+
+
+    void DirectMCS::ComputeResponse (
+
+        const VectorR& X, 
+        const VectorC& Load, 
+        const VectorR& MassBasisCoeffs, 
+        const VectorR& DamperBasisCoeffs, 
+        const VectorR& SpringBasisCoeffs, 
+        const VectorC& ForceBasisCoeffs, 
+        C* Response, 
+        Workspace& Work 
+
+    ) const {
+
+        SolveSamples<R> ( 
+
+            X.data(), X.size() / Dim_, Load, 
+            MassBasisCoeffs, DamperBasisCoeffs, 
+            SpringBasisCoeffs, ForceBasisCoeffs, 
+            Response, Work 
+
+        );
+
+    }
+
+} // Mass Spring Damper direct MCS compute response 
+
+
+namespace MassSpringDamper::Surrogate {
+
+    void DirectMCS::AccumulateResponse (
+
+        const VectorC& X, 
+        const VectorC& Load, 
+        const VectorR& MassBasisCoeffs, 
+        const VectorR& DamperBasisCoeffs, 
+        const VectorR& SpringBasisCoeffs, 
+        const VectorC& ForceBasisCoeffs, 
+        StreamingStatistics& Stats 
+
+    ) const {
+
+        AccumulateTiles<C> ( 
+
+            X, Load, 
+            MassBasisCoeffs, DamperBasisCoeffs, 
+            SpringBasisCoeffs, ForceBasisCoeffs, 
+            Stats 
+
+        );
+
+    }
+
+
+    void DirectMCS::AccumulateResponse (
+
+        const VectorR& X, 
+        const VectorC& Load, 
+        const VectorR& MassBasisCoeffs, 
+        const VectorR& DamperBasisCoeffs, 
+        const VectorR& SpringBasisCoeffs, 
+        const VectorC& ForceBasisCoeffs, 
+        StreamingStatistics& Stats 
+
+    ) const {
+
+        AccumulateTiles<R> ( 
+
+            X, Load, 
+            MassBasisCoeffs, DamperBasisCoeffs, 
+            SpringBasisCoeffs, ForceBasisCoeffs, 
+            Stats 
+
+        );
+
+    }
+
+
+    template < typename T >
+    void DirectMCS::AccumulateTiles (
+
+        const std::vector<T>& X, 
+        const VectorC& Load, 
+        const VectorR& MassBasisCoeffs, 
+        const VectorR& DamperBasisCoeffs, 
+        const VectorR& SpringBasisCoeffs, 
+        const VectorC& ForceBasisCoeffs, 
+        StreamingStatistics& Stats 
+
+    ) const {
+
+        Z nPoints = X.size() / Dim_;
+
+        Z Tile = ( TileSize_ == 0 || TileSize_ > nPoints ) ? nPoints : TileSize_;
+
+        // responses and scratch of one tile, reused by every tile 
+        VectorC Result ( Masses_.size() * Tile );
+
+        Workspace Work;
+
+        for ( Z i0 = 0; i0 < nPoints; i0 += Tile ) {
+
+            auto nTile = std::min ( Tile, nPoints - i0 );
+
+            SolveSamples<T> ( 
+
+                X.data() + i0 * Dim_, nTile, Load, 
+                MassBasisCoeffs, DamperBasisCoeffs, 
+                SpringBasisCoeffs, ForceBasisCoeffs, 
+                Result.data(), Work 
+
+            );
+
+            Stats.Add ( Result.data(), nTile );
+
+        }
+
+    }
+
+} // Mass Spring Damper direct MCS accumulate response 
+
+
+namespace MassSpringDamper::Surrogate {
+
+    template < typename T >
+    void DirectMCS::SolveSamples (
+
+        const T* X, 
+        const Z nPoints, 
+        const VectorC& Load, 
+        const VectorR& MassBasisCoeffs, 
+        const VectorR& DamperBasisCoeffs, 
+        const VectorR& SpringBasisCoeffs, 
+        const VectorC& ForceBasisCoeffs, 
+        C* Result, 
+        Workspace& Work 
+
+    ) const {
+
+        typedef Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic> MatrixXT;
 
-        auto nPoints = X.size() / Dim_; 
         auto nBasis  = Indices_.size() / Dim_; 
-        auto nDOFs   = SDModel_.Dim ();
+        auto nDOFs   = Masses_.size ();
+
+        T* Basis;
+
+        if constexpr ( std::is_same_v<T,R> ) {
+
+            Work.Args.resize ( nPoints * Dim_ );
+            Work.RealBasis.resize ( nBasis * nPoints );
+
+            auto& Args = Work.Args;
+
+            for ( auto i = 0; i < nPoints; i++ ) {
+            for ( auto m = 0; m < Dim_; m++ ) {
+
+                Args[m*nPoints+i] = X[i*Dim_+m];
+
+            }
+            }
+
+            BasisFunctions::HermitePolynomialsBatch<Z,R> ( 
+                Indices_, Args.data(), nPoints, Dim_, 
+                Work.RealBasis.data(), Work.RealScratch 
+            );
+
+            Basis = Work.RealBasis.data();
+
+        } else {
+
+            Work.Basis.resize ( nBasis * nPoints );
+
+            BasisFunctions::HermitePolynomials<Z,R,T> ( 
+                Indices_, X, nPoints, Dim_, Work.Basis.data(), Work.Scratch 
+            );
+
+            Basis = Work.Basis.data();
+
+            // real part is copied once, a strided operand would be copied 
+            // by each of the three products below 
+            Work.RealBasis.resize ( nBasis * nPoints );
+
+            for ( auto i = 0; i < nBasis * nPoints; i++ ) {
 
-        auto Basis = BasisFunctions::HermitePolynomials<Z,R,C> (
+                Work.RealBasis[i] = Basis[i].real();
 
-            Indices_, X, Dim_ 
+            }
 
+        }
+
+        Eigen::Map <MatrixXT> basis ( 
+            Basis, nBasis, nPoints 
         );
 
-        Eigen::Map <MatrixXC> basis ( 
-            Basis.data(), nBasis, nPoints 
+        Eigen::Map <const MatrixXR> realBasis ( 
+            Work.RealBasis.data(), nBasis, nPoints 
         );
 
-        VectorR RandomMasses ( nDOFs * nPoints ); 
+        // products are evaluated straight into the workspace 
+        auto& RandomMasses = Work.RandomMasses;
+
+        RandomMasses.resize ( nDOFs * nPoints ); 
 
         Eigen::Map <MatrixXR> randomMasses (
             RandomMasses.data(), nDOFs, nPoints 
@@ -89,10 +380,12 @@ namespace MassSpringDamper::Surrogate {
             MassBasisCoeffs.data(), nDOFs, nBasis 
         );
 
-        randomMasses = massBasisCoeffs * basis.real(); 
+        randomMasses.noalias() = massBasisCoeffs * realBasis; 
 
         
-        VectorR RandomDampers ( nDOFs * nPoints ); 
+        auto& RandomDampers = Work.RandomDampers;
+
+        RandomDampers.resize ( nDOFs * nPoints ); 
 
         Eigen::Map <MatrixXR> randomDampers (
             RandomDampers.data(), nDOFs, nPoints 
@@ -102,10 +395,12 @@ namespace MassSpringDamper::Surrogate {
             DamperBasisCoeffs.data(), nDOFs, nBasis 
         );
 
-        randomDampers = damperBasisCoeffs * basis.real(); 
+        randomDampers.noalias() = damperBasisCoeffs * realBasis; 
+
 
+        auto& RandomSprings = Work.RandomSprings;
 
-        VectorR RandomSprings ( nDOFs * nPoints ); 
+        RandomSprings.resize ( nDOFs * nPoints ); 
 
         Eigen::Map <MatrixXR> randomSprings (
             RandomSprings.data(), nDOFs, nPoints 
@@ -115,10 +410,12 @@ namespace MassSpringDamper::Surrogate {
             SpringBasisCoeffs.data(), nDOFs, nBasis 
         );
 
-        randomSprings = springBasisCoeffs * basis.real(); 
+        randomSprings.noalias() = springBasisCoeffs * realBasis; 
 
 
-        VectorC RandomForces ( nDOFs * nPoints );
+        auto& RandomForces = Work.RandomForces;
+
+        RandomForces.resize ( nDOFs * nPoints );
 
         Eigen::Map <MatrixXC> randomForces (
             RandomForces.data(), nDOFs, nPoints 
@@ -128,118 +425,214 @@ namespace MassSpringDamper::Surrogate {
             ForceBasisCoeffs.data(), nDOFs, nBasis 
         );
 
-        randomForces = forceBasisCoeffs * basis; 
+        randomForces.noalias() = forceBasisCoeffs * basis; 
 
 
-        VectorC Result ( nDOFs * nPoints );
+        Z nSlots = 1;
 
-        Eigen::Map <MatrixXC> result (
-            Result.data(), nDOFs, nPoints 
-        );
+#ifdef _OPENMP
+        int nThreads = Threads_ > 0 ? Threads_ : omp_get_max_threads();
 
-        for ( auto i = 0; i < nPoints; i++ ) {
+        nSlots = nThreads;
+#endif
 
-            VectorR Masses ( nDOFs );
+        if ( BatchSize_ > 0 && nPoints > 0 ) {
 
-            std::transform (
+            auto nBatch   = std::min ( BatchSize_, nPoints );
+            auto nBatches = ( nPoints + nBatch - 1 ) / nBatch;
 
-                RandomMasses.begin() + i * nDOFs, 
-                RandomMasses.begin() + i * nDOFs + nDOFs, 
-                Masses_.begin(), 
+            // entry of dof j and lane l at j * nBatch + l, six arrays 
+            if ( Work.Lanes.size() < nSlots ) Work.Lanes.resize ( nSlots );
 
-                Masses.begin(), 
+            for ( auto& Lanes : Work.Lanes ) Lanes.resize ( 6 * nDOFs * nBatch );
 
-                [](const auto m, const auto n) { return m+n; }
+            bool Failed = false;
 
-            );
+            // Batches are fixed chunks of samples written to disjoint columns, 
+            // results do not depend on the number of threads 
+            #pragma omp parallel num_threads ( nThreads )
+            {
 
-            auto RandomMassMatrix = SDModel_.MassMatrix ( Masses );
+            Z Slot = 0;
 
+#ifdef _OPENMP
+            Slot = omp_get_thread_num();
+#endif
 
-            VectorR Dampers ( nDOFs );
+            R* OffRe  = Work.Lanes[Slot].data();
+            R* OffIm  = OffRe  + nDOFs * nBatch;
+            R* DiagRe = OffIm  + nDOFs * nBatch;
+            R* DiagIm = DiagRe + nDOFs * nBatch;
+            R* RhsRe  = DiagIm + nDOFs * nBatch;
+            R* RhsIm  = RhsRe  + nDOFs * nBatch;
 
-            std::transform (
+            #pragma omp for schedule ( static )
+            for ( Z b = 0; b < nBatches; b++ ) {
 
-                RandomDampers.begin() + i * nDOFs, 
-                RandomDampers.begin() + i * nDOFs + nDOFs, 
-                Dampers_.begin(), 
+                auto i0     = b * nBatch;
+                auto nLanes = std::min ( nBatch, nPoints - i0 );
 
-                Dampers.begin(), 
+                // Gather samples into banded dynamic stiffness, spring and 
+                // damper j couple dofs j-1 and j 
+                for ( auto j = 0; j < nDOFs; j++ ) {
+                for ( auto l = 0; l < nLanes; l++ ) {
 
-                [](const auto m, const auto n) { return m+n; }
+                    auto p = j + ( i0 + l ) * nDOFs;
+                    auto q = j * nLanes + l;
 
-            );
+                    R m = Masses_ [j] + RandomMasses [p];
+                    R c = Dampers_[j] + RandomDampers[p];
+                    R k = Springs_[j] + RandomSprings[p];
 
-            auto RandomDamping = SDModel_.DampingMatrix ( Dampers );
+                    DiagRe[q] = k - Omega_ * Omega_ * m;
+                    DiagIm[q] = Omega_ * c;
 
-            VectorR Springs ( nDOFs );
+                    OffRe[q] = 0.0;
+                    OffIm[q] = 0.0;
 
-            std::transform (
+                    if ( j > 0 ) {
 
-                RandomSprings.begin() + i * nDOFs, 
-                RandomSprings.begin() + i * nDOFs + nDOFs, 
-                Springs_.begin(), 
+                        DiagRe[q-nLanes] += k;
+                        DiagIm[q-nLanes] += Omega_ * c;
 
-                Springs.begin(), 
+                        OffRe[q-nLanes] = -k;
+                        OffIm[q-nLanes] = -Omega_ * c;
 
-                [](const auto m, const auto n) { return m+n; }
+                    }
 
-            );
+                    C f = Load[j] + RandomForces[p];
 
-            auto RandomStiffness = SDModel_.StiffnessMatrix ( Springs );
+                    RhsRe[q] = f.real();
+                    RhsIm[q] = f.imag();
 
+                }
+                }
 
-            VectorC Forces ( nDOFs );
+                // exceptions must not leave the parallel region 
+                try {
 
-            std::transform (
+                    Analytical::SolveTridiagonalBatch<Z,R> ( 
 
-                RandomForces.begin() + i * nDOFs, 
-                RandomForces.begin() + i * nDOFs + nDOFs, 
-                Load.begin(), 
+                        nDOFs, nLanes, 
+                        OffRe,  OffIm, 
+                        DiagRe, DiagIm, 
+                        RhsRe,  RhsIm 
 
-                Forces.begin(), 
+                    );
 
-                [](const auto m, const auto n) { return m+n; }
+                } catch ( const std::runtime_error& ) {
 
-            );
+                    #pragma omp atomic write 
+                    Failed = true;
 
-            VectorC RandomDynStiffness ( nDOFs * nDOFs, 0.0 );
+                    continue;
 
-            Eigen::Map <MatrixXR> randomMassMatrix ( 
-                RandomMassMatrix.data(), nDOFs, nDOFs 
-            );
+                }
 
-            Eigen::Map <MatrixXR> randomDamping ( 
-                RandomDamping.data(), nDOFs, nDOFs 
-            );
+                for ( auto l = 0; l < nLanes; l++ ) {
+                for ( auto j = 0; j < nDOFs; j++ ) {
 
-            Eigen::Map <MatrixXR> randomStiffness ( 
-                RandomStiffness.data(), nDOFs, nDOFs 
-            );
+                    Result[j+(i0+l)*nDOFs] = C ( 
+                        RhsRe[j*nLanes+l], RhsIm[j*nLanes+l] 
+                    );
 
-            Eigen::Map <MatrixXC> randomDynStiffness ( 
-                RandomDynStiffness.data(), nDOFs, nDOFs 
-            );
+                }
+                }
+
+            }
+
+            } // omp parallel 
+
+            if ( Failed ) {
+
+                throw std::runtime_error (
+                    "DirectMCS: zero pivot in batched solver, use batch size 0"
+                );
+
+            }
+
+            return;
+
+        }
 
-            randomDynStiffness.real() = 
-                randomStiffness - Omega_ * Omega_ * randomMassMatrix;
+        if ( Work.Bands.size() < nSlots ) Work.Bands.resize ( nSlots );
 
-            randomDynStiffness.imag() = 
-                Omega_ * randomDamping;
+        for ( auto& Band : Work.Bands ) Band.resize ( 3 * nDOFs );
+
+        // random parts become sample parameters in place 
+        for ( auto i = 0; i < nPoints; i++ ) {
+        for ( auto j = 0; j < nDOFs; j++ ) {
+
+            RandomMasses [j+i*nDOFs] += Masses_ [j];
+            RandomDampers[j+i*nDOFs] += Dampers_[j];
+            RandomSprings[j+i*nDOFs] += Springs_[j];
+
+        }
+        }
+
+        bool Failed = false;
+
+        #pragma omp parallel for num_threads ( nThreads ) schedule ( static ) 
+        for ( Z i = 0; i < nPoints; i++ ) {
+
+            Z Slot = 0;
+
+#ifdef _OPENMP 
+            Slot = omp_get_thread_num();
+#endif 
+
+            auto& Band = Work.Bands[Slot];
+
+            SDModel_.AssembleDynamicStiffness ( 
+
+                Omega_, 
+                RandomMasses .data() + i * nDOFs, 
+                RandomDampers.data() + i * nDOFs, 
+                RandomSprings.data() + i * nDOFs, 
+                Band.data() 
 
-            Eigen::Map <VectorXC> forces (
-                Forces.data(), nDOFs 
             );
 
-            result.col(i) = randomDynStiffness.partialPivLu().solve(forces);
+            // load of the sample is solved in place in its column 
+            C* response = Result + i * nDOFs;
+
+            for ( auto j = 0; j < nDOFs; j++ ) {
+
+                response[j] = RandomForces[j+i*nDOFs] + Load[j];
+
+            }
+
+            // exceptions must not leave the parallel region 
+            try {
+
+                Analytical::SolveTridiagonal<Z,C> ( 
+
+                    nDOFs, 
+                    Band.data() + 1, 
+                    Band.data() + nDOFs, 
+                    Band.data() + 2 * nDOFs, 
+                    response 
+
+                );
+
+            } catch ( const std::runtime_error& ) {
+
+                #pragma omp atomic write 
+                Failed = true;
+
+            }
 
         }
 
-        return Result;
+        if ( Failed ) {
 
-    }
+            throw std::runtime_error (
+                "DirectMCS: singular dynamic stiffness of a sample"
+            );
 
+        }
 
-}
+    }
 
 
+}
\ No newline at end of file
@@ -20,7 +20,11 @@ namespace MassSpringDamper::Surrogate {
 
         const AnalyticalModel* SDModel, const R Omega, const Z Dim 
 
-    ) : SDModel_( SDModel ), Omega_( Omega ), Dim_( Dim ) {}
+    ) : 
+        SDModel_( SDModel ), 
+        Solver_( GalerkinSolver::DenseLU ), 
+        Tolerance_( 1e-10 ), MaxIterations_( 1000 ), TileSize_( 0 ), 
+        Omega_( Omega ), Dim_( Dim ) {}
 
 } // Mass Spring Damper Intrusive PCE constructor 
 
@@ -37,11 +41,51 @@ namespace MassSpringDamper::Surrogate {
 
         Indices_ = Indices;
 
+        // triples and sweeps of the previous indices are no longer valid 
+        Triples_ = BasisFunctions::TripleProductTensor<Z,R> ();
+
+        Omegas_.clear();
+        SweepCoeffs_.clear();
+
     }
 
 } // Mass Spring Damper Intrusive PCE set indices 
 
 
+namespace MassSpringDamper::Surrogate {
+
+    void IntrusivePCE::SetSolver ( const GalerkinSolver Solver ) {
+
+        Solver_ = Solver;
+
+    }
+
+} // Mass Spring Damper Intrusive PCE set solver 
+
+
+namespace MassSpringDamper::Surrogate {
+
+    void IntrusivePCE::SetTolerance ( const R Tolerance, const Z MaxIterations ) {
+
+        Tolerance_     = Tolerance;
+        MaxIterations_ = MaxIterations;
+
+    }
+
+} // Mass Spring Damper Intrusive PCE set tolerance 
+
+
+namespace MassSpringDamper::Surrogate {
+
+    void IntrusivePCE::SetTileSize ( const Z TileSize ) {
+
+        TileSize_ = TileSize;
+
+    }
+
+} // Mass Spring Damper Intrusive PCE set tile size 
+
+
 namespace MassSpringDamper::Surrogate {
 
     void IntrusivePCE::Train (
@@ -54,145 +98,445 @@ namespace MassSpringDamper::Surrogate {
 
     ) {
 
+        // coefficients of a previous sweep no longer match this training 
+        Omegas_.clear();
+        SweepCoeffs_.clear();
+
         auto nBasis = Indices_.size() / Dim_;
         auto nDOFs  = SDModel_ -> Dim ();
 
-        auto DynamicStiffness = SDModel_ -> DynamicStiffness ( Omega_ );
-
-        auto ExpHermiteTriples = BasisFunctions::ExpHermiteTriples<Z,R> (
+        auto nRandomBasis = MassBasisCoeffs.size() / nDOFs;
 
-            Indices_, 
-            Dim(), 
-            0
+        // Galerkin system is sum_k ( T_k x K_k ), T_k(i,j) = E(H_k,H_i,H_j) 
+        auto Triples = GalerkinTerms ( nRandomBasis );
 
-        );
+        std::vector<MatrixXC> Stiffnesses; 
 
 
         // ===================================================================
         // Calculate deterministic part of modified dynamic stiffness matrix 
         // ===================================================================
 
+        auto DynamicStiffness = SDModel_ -> DynamicStiffness ( Omega_ );
+
         Eigen::Map<MatrixXC, Eigen::RowMajor> dynamicStiffness ( 
             DynamicStiffness.data(), nDOFs, nDOFs  
         );
 
-        Eigen::Map<MatrixXR> expHermiteTriples ( 
-            ExpHermiteTriples.data(), nBasis, nBasis 
-        );
+        Stiffnesses.push_back ( dynamicStiffness );
 
-        MatrixXC modDynamicStiffness = 
-            MatrixXC::Zero ( nBasis * nDOFs, nBasis * nDOFs );
 
-        for ( auto i = 0; i < nBasis; i++ ) {
-        for ( auto j = 0; j < nBasis; j++ ) {
+        // ===================================================================
+        // Calculate random part of modified dynamic stiffness matrix 
+        // ===================================================================
+
+        VectorC Band ( 3 * nDOFs );
 
-            modDynamicStiffness.block ( 
+        for ( auto k = 0; k < nRandomBasis; k++ ) {
+
+            // bands of the k-th coefficients, expanded to the dense block 
+            SDModel_ -> AssembleDynamicStiffness ( 
 
-                i * nDOFs, 
-                j * nDOFs, 
+                Omega_, 
+                MassBasisCoeffs  .data() + k * nDOFs, 
+                DamperBasisCoeffs.data() + k * nDOFs, 
+                SpringBasisCoeffs.data() + k * nDOFs, 
+                Band.data() 
 
-                nDOFs, nDOFs 
+            );
 
-            ) += expHermiteTriples(i,j) * dynamicStiffness;
+            MatrixXC randomDynStiffness = MatrixXC::Zero ( nDOFs, nDOFs );
+
+            randomDynStiffness.diagonal (  0 ) = 
+                Eigen::Map<VectorXC> ( Band.data() + nDOFs, nDOFs );
+
+            randomDynStiffness.diagonal ( -1 ) = 
+                Eigen::Map<VectorXC> ( Band.data() + 1, nDOFs - 1 );
+
+            randomDynStiffness.diagonal (  1 ) = 
+                Eigen::Map<VectorXC> ( Band.data() + 2 * nDOFs, nDOFs - 1 );
+
+            Stiffnesses.push_back ( randomDynStiffness );
 
-        }
         }
 
 
         // ===================================================================
-        // Calculate random part of modified dynamic stiffness matrix 
+        // Assemble modified force vector 
+        // ===================================================================
+
+        auto force = GalerkinForce ( Load, ForceBasisCoeffs );
+
+
+        // ===================================================================
+        // Solve for coefficients of basis functions 
         // ===================================================================
 
+        Coeffs_ = VectorC ( nDOFs * nBasis, 0.0 );
+
+        switch ( Solver_ ) {
+
+            case GalerkinSolver::DenseLU: 
+                SolveDense ( Triples, Stiffnesses, force ); 
+                break;
+
+            case GalerkinSolver::SparseLU: 
+                SolveSparse ( Triples, Stiffnesses, force ); 
+                break;
+
+            case GalerkinSolver::MatrixFree: 
+                SolveMatrixFree ( Triples, Stiffnesses, force ); 
+                break;
+
+        }
+
+    }
+
+} // Mass Spring Damper Intrusive PCE train 
+
+
+namespace MassSpringDamper::Surrogate {
+
+    void IntrusivePCE::TrainSweep (
+
+        const VectorR& Omegas, 
+        const VectorC& Load, 
+        const VectorR& MassBasisCoeffs, 
+        const VectorR& DamperBasisCoeffs, 
+        const VectorR& SpringBasisCoeffs, 
+        const VectorC& ForceBasisCoeffs, 
+        const bool WarmStart 
+
+    ) {
+
+        if ( Omegas.empty() ) {
+
+            throw std::runtime_error (
+                "IntrusivePCE: no angular velocities to train"
+            );
+
+        }
+
+        auto nBasis = Indices_.size() / Dim_;
+        auto nDOFs  = SDModel_ -> Dim ();
+
         auto nRandomBasis = MassBasisCoeffs.size() / nDOFs;
 
+        auto n = nDOFs * nBasis;
+
+        auto Triples = GalerkinTerms ( nRandomBasis );
+        auto force   = GalerkinForce ( Load, ForceBasisCoeffs );
+
+
+        // =================================================================== 
+        // Real bands { Sub, Diag, Super } of M_k, C_k and K_k of each term 
+        // =================================================================== 
+
+        std::vector<VectorR> MassBands, DampingBands, StiffnessBands;
+
+        MassBands     .push_back ( SDModel_ -> MassBand      () );
+        DampingBands  .push_back ( SDModel_ -> DampingBand   () );
+        StiffnessBands.push_back ( SDModel_ -> StiffnessBand () );
+
         for ( auto k = 0; k < nRandomBasis; k++ ) {
 
-            VectorR RandomMasses ( 
+            auto Slice = [&]( const VectorR& Coeffs ) {
 
-                MassBasisCoeffs.begin() + k * nDOFs, 
-                MassBasisCoeffs.begin() + k * nDOFs + nDOFs 
+                return VectorR ( 
+                    Coeffs.begin() +   k       * nDOFs, 
+                    Coeffs.begin() + ( k + 1 ) * nDOFs 
+                );
 
-            );
+            };
 
-            auto RandomMassMatrix = SDModel_ -> MassMatrix ( RandomMasses );
+            auto Masses  = Slice ( MassBasisCoeffs   );
+            auto Dampers = Slice ( DamperBasisCoeffs );
+            auto Springs = Slice ( SpringBasisCoeffs );
 
-            VectorR RandomDampers ( 
+            MassBands     .push_back ( SDModel_ -> MassBand      ( Masses  ) );
+            DampingBands  .push_back ( SDModel_ -> DampingBand   ( Dampers ) );
+            StiffnessBands.push_back ( SDModel_ -> StiffnessBand ( Springs ) );
 
-                DamperBasisCoeffs.begin() + k * nDOFs, 
-                DamperBasisCoeffs.begin() + k * nDOFs + nDOFs 
+        }
 
-            );
+        // visit entries A(r,c) of a tridiagonal block, b is the band position 
+        auto ForBand = [&]( auto&& f ) {
 
-            auto RandomDamping = SDModel_ -> DampingMatrix ( RandomDampers );
+            for ( Z r = 0; r < nDOFs; r++ ) {
 
-            VectorR RandomSprings ( 
+                auto Last = std::min<Z> ( r + 2, nDOFs );
 
-                SpringBasisCoeffs.begin() + k * nDOFs, 
-                SpringBasisCoeffs.begin() + k * nDOFs + nDOFs 
+                for ( Z c = r > 0 ? r - 1 : 0; c < Last; c++ ) {
 
-            );
+                    f ( r, c, ( c + 1 - r ) * nDOFs + r );
 
-            auto RandomStiffness = SDModel_ -> StiffnessMatrix ( RandomSprings );
+                }
 
-            VectorC RandomDynStiffness ( nDOFs * nDOFs, 0.0 );
+            }
 
-            Eigen::Map <MatrixXR> randomMassMatrix ( 
-                RandomMassMatrix.data(), nDOFs, nDOFs 
-            );
+        };
 
-            Eigen::Map <MatrixXR> randomDamping ( 
-                RandomDamping.data(), nDOFs, nDOFs 
-            );
 
-            Eigen::Map <MatrixXR> randomStiffness ( 
-                RandomStiffness.data(), nDOFs, nDOFs 
-            );
+        // =================================================================== 
+        // Galerkin operators sum_k ( T_k x M_k ), ... share one pattern 
+        // =================================================================== 
+
+        SparseMatrixXR Mass, Damping, Stiffness;
+        SparseMatrixXC DynamicStiffness;
+
+        if ( Solver_ != GalerkinSolver::MatrixFree ) {
+
+            Stiffness = GalerkinPattern ( Triples );
+
+            Mass    = Stiffness;
+            Damping = Stiffness;
+
+            R* mass      = Mass     .valuePtr();
+            R* damping   = Damping  .valuePtr();
+            R* stiffness = Stiffness.valuePtr();
+
+            for ( auto k = 0; k < Triples.size(); k++ ) {
+
+                const auto& T = Triples[k];
+
+                const auto& m = MassBands     [k];
+                const auto& d = DampingBands  [k];
+                const auto& s = StiffnessBands[k];
+
+                for ( auto j = 0; j < T.outerSize(); j++ ) {
+                for ( SparseMatrixXR::InnerIterator t ( T, j ); t; ++t ) {
+
+                    ForBand ( [&]( Z r, Z c, Z b ) {
+
+                        // same position in all three operators 
+                        auto e = &Stiffness.coeffRef ( 
+                            t.row() * nDOFs + r, j * nDOFs + c 
+                        ) - stiffness;
+
+                        mass     [e] += t.value() * m[b];
+                        damping  [e] += t.value() * d[b];
+                        stiffness[e] += t.value() * s[b];
+
+                    } );
+
+                }
+                }
+
+            }
+
+            DynamicStiffness = Stiffness.cast<C> ();
+
+        }
+
+
+        // =================================================================== 
+        // Solve each frequency, factorization structures are reused 
+        // =================================================================== 
+
+        Eigen::SparseLU<SparseMatrixXC> SparseLU;
+        Eigen::PartialPivLU<MatrixXC> DenseLU;
+
+        MatrixXC Dense;
+
+        std::vector<MatrixXC> Stiffnesses ( Triples.size() );
+
+        if ( Solver_ == GalerkinSolver::SparseLU ) {
+
+            SparseLU.analyzePattern ( DynamicStiffness );
+
+        }
 
-            Eigen::Map <MatrixXC> randomDynStiffness ( 
-                RandomDynStiffness.data(), nDOFs, nDOFs 
+        Omegas_ = Omegas;
+        SweepCoeffs_.resize ( Omegas.size() * n );
+
+        Coeffs_ = VectorC ( n, 0.0 );
+
+        Eigen::Map<VectorXC> coeffs ( Coeffs_.data(), n );
+
+        for ( auto w = 0; w < Omegas.size(); w++ ) {
+
+            R omega = Omegas[w];
+
+            if ( Solver_ == GalerkinSolver::MatrixFree ) {
+
+                for ( auto k = 0; k < Triples.size(); k++ ) {
+
+                    const auto& m = MassBands     [k];
+                    const auto& d = DampingBands  [k];
+                    const auto& s = StiffnessBands[k];
+
+                    Stiffnesses[k] = MatrixXC::Zero ( nDOFs, nDOFs );
+
+                    ForBand ( [&]( Z r, Z c, Z b ) {
+
+                        Stiffnesses[k](r,c) = C ( 
+                            s[b] - omega * omega * m[b], omega * d[b] 
+                        );
+
+                    } );
+
+                }
+
+                // Coeffs_ still holds the solution of the previous frequency 
+                SolveMatrixFree ( 
+                    Triples, Stiffnesses, force, WarmStart && w > 0 
+                );
+
+            } else {
+
+                const R* m = Mass     .valuePtr();
+                const R* d = Damping  .valuePtr();
+                const R* k = Stiffness.valuePtr();
+
+                C* a = DynamicStiffness.valuePtr();
+
+                for ( auto e = 0; e < DynamicStiffness.nonZeros(); e++ ) {
+
+                    a[e] = C ( k[e] - omega * omega * m[e], omega * d[e] );
+
+                }
+
+                if ( Solver_ == GalerkinSolver::SparseLU ) {
+
+                    SparseLU.factorize ( DynamicStiffness );
+
+                    if ( SparseLU.info() != Eigen::Success ) {
+
+                        throw std::runtime_error (
+                            "IntrusivePCE: sparse LU factorization failed"
+                        );
+
+                    }
+
+                    coeffs = SparseLU.solve ( force );
+
+                } else {
+
+                    Dense = DynamicStiffness;
+
+                    DenseLU.compute ( Dense );
+
+                    coeffs = DenseLU.solve ( force );
+
+                }
+
+            }
+
+            std::copy ( 
+                Coeffs_.begin(), Coeffs_.end(), SweepCoeffs_.begin() + w * n 
             );
 
-            randomDynStiffness.real() = 
-                randomStiffness - Omega_ * Omega_ * randomMassMatrix;
+        }
+
+        SelectFrequency ( 0 );
+
+    }
+
+} // Mass Spring Damper Intrusive PCE train sweep 
+
+
+namespace MassSpringDamper::Surrogate {
 
-            randomDynStiffness.imag() = 
-                Omega_ * randomDamping;
-            
-            auto EHermiteTriples = BasisFunctions::ExpHermiteTriples<Z,R> (
+    void IntrusivePCE::SelectFrequency ( const Z w ) {
 
-                Indices_, 
-                Dim(), 
-                k
+        if ( w >= Omegas_.size() ) {
 
+            throw std::runtime_error (
+                "IntrusivePCE: frequency index out of range"
             );
 
-            Eigen::Map<MatrixXR> eHermiteTriples ( 
-                EHermiteTriples.data(), nBasis, nBasis 
+        }
+
+        auto n = SweepCoeffs_.size() / Omegas_.size();
+
+        // Omega_ stays the frequency of Train 
+        Coeffs_.assign ( 
+            SweepCoeffs_.begin() +   w       * n, 
+            SweepCoeffs_.begin() + ( w + 1 ) * n 
+        );
+
+    }
+
+} // Mass Spring Damper Intrusive PCE select frequency 
+
+
+namespace MassSpringDamper::Surrogate {
+
+    SparseMatrixXR IntrusivePCE::GalerkinTriples ( const Z k ) const {
+
+        auto nBasis = Indices_.size() / Dim_;
+
+        const auto& Offsets = Triples_.Offsets();
+
+        std::vector<Eigen::Triplet<R>> Entries; 
+        Entries.reserve ( Offsets[k+1] - Offsets[k] );
+
+        for ( auto e = Offsets[k]; e < Offsets[k+1]; e++ ) {
+
+            Entries.emplace_back ( 
+                Triples_.Rows()[e], Triples_.Cols()[e], Triples_.Values()[e] 
             );
 
-            for ( auto i = 0; i < nBasis; i++ ) {
-            for ( auto j = 0; j < nBasis; j++ ) {
+        }
 
-                modDynamicStiffness.block ( 
+        SparseMatrixXR result ( nBasis, nBasis );
+        result.setFromTriplets ( Entries.begin(), Entries.end() );
 
-                    i * nDOFs, 
-                    j * nDOFs, 
+        return result;
 
-                    nDOFs, nDOFs 
+    }
 
-                ) += eHermiteTriples(i,j) * randomDynStiffness;
+} // Mass Spring Damper Intrusive PCE Galerkin triples 
 
-            }
-            }
+
+namespace MassSpringDamper::Surrogate {
+
+    std::vector<SparseMatrixXR> IntrusivePCE::GalerkinTerms ( 
+
+        const Z nRandomBasis 
+
+    ) {
+
+        auto nBasis = Indices_.size() / Dim_;
+
+        // enumerate non-zero triples once, later trainings reuse them 
+        auto nSlices = std::max<Z> ( nRandomBasis, 1 );
+
+        if ( Triples_.nBasis() != nBasis || Triples_.nSlices() < nSlices ) {
+
+            Triples_ = BasisFunctions::TripleProductTensor<Z,R> ( 
+                Indices_, Dim(), nSlices 
+            );
 
         }
 
+        std::vector<SparseMatrixXR> Triples; 
 
-        // ===================================================================
-        // Solve for coefficients of basis functions 
-        // ===================================================================
+        Triples.push_back ( GalerkinTriples ( 0 ) );
 
-        Coeffs_ = VectorC ( nDOFs * nBasis, 0.0 );
+        for ( auto k = 0; k < nRandomBasis; k++ ) {
+
+            Triples.push_back ( GalerkinTriples ( k ) );
+
+        }
+
+        return Triples;
+
+    }
+
+} // Mass Spring Damper Intrusive PCE Galerkin terms 
+
+
+namespace MassSpringDamper::Surrogate {
+
+    VectorXC IntrusivePCE::GalerkinForce ( 
+
+        const VectorC& Load, const VectorC& ForceBasisCoeffs 
+
+    ) const {
+
+        auto nBasis = Indices_.size() / Dim_;
+        auto nDOFs  = SDModel_ -> Dim ();
 
         VectorXC force = VectorXC::Zero( nDOFs * nBasis );
 
@@ -200,10 +544,6 @@ namespace MassSpringDamper::Surrogate {
             Load.data(), nDOFs 
         );
 
-        Eigen::Map<VectorXC> coeffs ( 
-            Coeffs_.data(), nDOFs * nBasis 
-        );
-
         force.segment ( 0, nDOFs ) = load;
 
         Eigen::Map<const VectorXC> randomLoad ( 
@@ -212,58 +552,670 @@ namespace MassSpringDamper::Surrogate {
 
         force.segment ( 0, ForceBasisCoeffs.size() ) += randomLoad;
 
-        coeffs = modDynamicStiffness.partialPivLu().solve(force);
+        return force;
 
     }
 
-} // Mass Spring Damper Intrusive PCE train 
+} // Mass Spring Damper Intrusive PCE Galerkin force 
+
 
 namespace MassSpringDamper::Surrogate {
 
-    VectorC IntrusivePCE::ComputeResponse ( const VectorC& X ) const {
+    SparseMatrixXR IntrusivePCE::GalerkinPattern ( 
 
-        auto nPoints = X.size() / Dim_;
-        auto nBasis  = Indices_.size() / Dim_;
-        auto nDOFs   = SDModel_ -> Dim ();
+        const std::vector<SparseMatrixXR>& Triples 
 
-        // Compute basis functions with random inputs as arguments 
-        auto Basis = BasisFunctions::HermitePolynomials<Z,R,C> (
+    ) const {
 
-                Indices_, X, Dim_ 
+        auto nBasis = Indices_.size() / Dim_;
+        auto nDOFs  = SDModel_ -> Dim ();
 
-        );
+        // union of the patterns of all T_k, sums keep explicit zeros 
+        SparseMatrixXR Blocks ( nBasis, nBasis );
 
-        VectorC Response ( nDOFs * nPoints );
+        for ( const auto& T : Triples ) Blocks += T;
 
+        // each non-zero block holds a tridiagonal nDOFs x nDOFs block 
+        Eigen::VectorXi Sizes ( nBasis * nDOFs );
 
-        // ===================================================================
-        // Map vectors to eigen objects for linear algebra operations 
-        // ===================================================================
+        for ( Z j = 0; j < nBasis; j++ ) {
 
-        Eigen::Map<MatrixXC> basis ( 
-            Basis.data(), nBasis , nPoints
-        );
+            Z nBlocks = Blocks.col ( j ).nonZeros();
 
-        Eigen::Map<const MatrixXC> coeffs (
-            Coeffs_.data(), nDOFs, nBasis 
-        );
+            for ( Z c = 0; c < nDOFs; c++ ) {
 
-        Eigen::Map<MatrixXC> response ( 
-            Response.data(), nDOFs, nPoints 
-        );
+                Z nBand = std::min<Z> ( c + 2, nDOFs ) - ( c > 0 ? c - 1 : 0 );
 
+                Sizes[j*nDOFs+c] = nBlocks * nBand;
 
-        // ===================================================================
-        // Approximate response as linear combination of basis functions 
-        // ===================================================================
+            }
 
-        response = coeffs * basis;
+        }
 
-        return Response;
+        SparseMatrixXR Pattern ( nBasis * nDOFs, nBasis * nDOFs );
 
-    }
+        Pattern.reserve ( Sizes );
 
-} // Mass Spring Damper Intrusive PCE compute response 
+        for ( Z j = 0; j < nBasis; j++ ) {
+        for ( Z c = 0; c < nDOFs; c++ ) {
+
+            auto Last = std::min<Z> ( c + 2, nDOFs );
+
+            // block rows ascend, so rows of a column are inserted in order 
+            for ( SparseMatrixXR::InnerIterator t ( Blocks, j ); t; ++t ) {
+            for ( Z r = c > 0 ? c - 1 : 0; r < Last; r++ ) {
+
+                Pattern.insert ( t.row() * nDOFs + r, j * nDOFs + c ) = 0.0;
+
+            }
+            }
+
+        }
+        }
+
+        Pattern.makeCompressed();
+
+        return Pattern;
+
+    }
+
+} // Mass Spring Damper Intrusive PCE Galerkin pattern 
+
+
+namespace MassSpringDamper::Surrogate {
+
+    void IntrusivePCE::SolveDense ( 
+
+        const std::vector<SparseMatrixXR>& Triples, 
+        const std::vector<MatrixXC>& Stiffnesses, 
+        const VectorXC& Force 
+
+    ) {
+
+        auto nBasis = Indices_.size() / Dim_;
+        auto nDOFs  = SDModel_ -> Dim ();
+
+        MatrixXC modDynamicStiffness = 
+            MatrixXC::Zero ( nBasis * nDOFs, nBasis * nDOFs );
+
+        for ( auto k = 0; k < Triples.size(); k++ ) {
+
+            const auto& T = Triples[k];
+
+            for ( auto j = 0; j < T.outerSize(); j++ ) {
+            for ( SparseMatrixXR::InnerIterator t ( T, j ); t; ++t ) {
+
+                modDynamicStiffness.block ( 
+
+                    t.row() * nDOFs, 
+                    j * nDOFs, 
+
+                    nDOFs, nDOFs 
+
+                ) += t.value() * Stiffnesses[k];
+
+            }
+            }
+
+        }
+
+        Eigen::Map<VectorXC> coeffs ( 
+            Coeffs_.data(), nDOFs * nBasis 
+        );
+
+        coeffs = modDynamicStiffness.partialPivLu().solve(Force);
+
+    }
+
+} // Mass Spring Damper Intrusive PCE dense solver 
+
+
+namespace MassSpringDamper::Surrogate {
+
+    void IntrusivePCE::SolveSparse ( 
+
+        const std::vector<SparseMatrixXR>& Triples, 
+        const std::vector<MatrixXC>& Stiffnesses, 
+        const VectorXC& Force 
+
+    ) {
+
+        auto nBasis = Indices_.size() / Dim_;
+        auto nDOFs  = SDModel_ -> Dim ();
+
+        // entries of all k are summed in place on the final pattern 
+        SparseMatrixXC sparseDynamicStiffness = 
+            GalerkinPattern ( Triples ).cast<C> ();
+
+        for ( auto k = 0; k < Triples.size(); k++ ) {
+
+            const auto& T = Triples[k];
+            const auto& K = Stiffnesses[k];
+
+            for ( auto j = 0; j < T.outerSize(); j++ ) {
+            for ( SparseMatrixXR::InnerIterator t ( T, j ); t; ++t ) {
+
+                // K_k is tridiagonal 
+                for ( Z c = 0; c < nDOFs; c++ ) {
+
+                    auto Last = std::min<Z> ( c + 2, nDOFs );
+
+                    for ( Z r = c > 0 ? c - 1 : 0; r < Last; r++ ) {
+
+                        sparseDynamicStiffness.coeffRef ( 
+                            t.row() * nDOFs + r, j * nDOFs + c 
+                        ) += t.value() * K(r,c);
+
+                    }
+
+                }
+
+            }
+            }
+
+        }
+
+        Eigen::SparseLU<SparseMatrixXC> solver ( sparseDynamicStiffness );
+
+        if ( solver.info() != Eigen::Success ) {
+
+            throw std::runtime_error (
+                "IntrusivePCE: sparse LU factorization failed"
+            );
+
+        }
+
+        Eigen::Map<VectorXC> coeffs ( 
+            Coeffs_.data(), nDOFs * nBasis 
+        );
+
+        coeffs = solver.solve(Force);
+
+    }
+
+} // Mass Spring Damper Intrusive PCE sparse solver 
+
+
+namespace MassSpringDamper::Surrogate {
+
+    void IntrusivePCE::SolveMatrixFree ( 
+
+        const std::vector<SparseMatrixXR>& Triples, 
+        const std::vector<MatrixXC>& Stiffnesses, 
+        const VectorXC& Force, 
+        const bool WarmStart 
+
+    ) {
+
+        auto nBasis = Indices_.size() / Dim_;
+        auto nDOFs  = SDModel_ -> Dim ();
+
+
+        // ===================================================================
+        // Galerkin operator: Y = sum_k K_k X T_k, X is nDOFs x nBasis 
+        // ===================================================================
+
+        MatrixXC KX ( nDOFs, nBasis );
+
+        auto Apply = [&]( const VectorXC& x, VectorXC& y ) {
+
+            Eigen::Map<const MatrixXC> X ( x.data(), nDOFs, nBasis );
+            Eigen::Map<MatrixXC> Y ( y.data(), nDOFs, nBasis );
+
+            Y.setZero();
+
+            for ( auto k = 0; k < Triples.size(); k++ ) {
+
+                const auto& T = Triples[k];
+
+                KX.noalias() = Stiffnesses[k] * X;
+
+                for ( auto j = 0; j < T.outerSize(); j++ ) {
+                for ( SparseMatrixXR::InnerIterator t ( T, j ); t; ++t ) {
+
+                    Y.col ( t.row() ) += t.value() * KX.col ( j );
+
+                }
+                }
+
+            }
+
+        };
+
+
+        // ===================================================================
+        // Preconditioner: block diagonal I x E(K), only one LU of nDOFs^2 
+        // ===================================================================
+
+        MatrixXC MeanStiffness = MatrixXC::Zero ( nDOFs, nDOFs );
+
+        for ( auto k = 0; k < Triples.size(); k++ ) {
+
+            MeanStiffness += Triples[k].coeff ( 0, 0 ) * Stiffnesses[k];
+
+        }
+
+        auto MeanLU = MeanStiffness.partialPivLu();
+
+        auto Precondition = [&]( const VectorXC& x, VectorXC& y ) {
+
+            Eigen::Map<const MatrixXC> X ( x.data(), nDOFs, nBasis );
+            Eigen::Map<MatrixXC> Y ( y.data(), nDOFs, nBasis );
+
+            Y = MeanLU.solve ( X );
+
+        };
+
+
+        // ===================================================================
+        // Right preconditioned BiCGSTAB, started from mean-based solution 
+        // or from the current coefficients when warm starting 
+        // ===================================================================
+
+        auto n = nDOFs * nBasis;
+
+        VectorXC x ( n ), r ( n ), r0 ( n ), p ( n ), v ( n );
+        VectorXC s ( n ), t ( n ), y ( n ), z ( n );
+
+        if ( WarmStart && Coeffs_.size() == n ) {
+
+            x = Eigen::Map<const VectorXC> ( Coeffs_.data(), n );
+
+        } else {
+
+            Precondition ( Force, x );
+
+        }
+
+        Apply ( x, r );
+
+        r  = Force - r;
+        r0 = r;
+
+        p.setZero();
+        v.setZero();
+
+        C rho = 1.0, alpha = 1.0, omega = 1.0;
+
+        R ForceNorm = Force.norm();
+        R Threshold = Tolerance_ * ( ForceNorm > 0.0 ? ForceNorm : R(1.0) );
+
+        auto Converged = ( r.norm() <= Threshold );
+
+        for ( auto i = 0; i < MaxIterations_ && !Converged; i++ ) {
+
+            C rhoNew = r0.dot ( r );
+
+            if ( rhoNew == C(0.0) ) break;
+
+            C beta = ( rhoNew / rho ) * ( alpha / omega );
+            rho = rhoNew;
+
+            p = r + beta * ( p - omega * v );
+
+            Precondition ( p, y );
+            Apply ( y, v );
+
+            alpha = rho / r0.dot ( v );
+
+            s = r - alpha * v;
+            x += alpha * y;
+
+            if ( s.norm() <= Threshold ) { Converged = true; break; }
+
+            Precondition ( s, z );
+            Apply ( z, t );
+
+            omega = t.dot ( s ) / t.squaredNorm();
+
+            x += omega * z;
+            r  = s - omega * t;
+
+            Converged = ( r.norm() <= Threshold );
+
+            if ( omega == C(0.0) ) break;
+
+        }
+
+        if ( !Converged ) {
+
+            throw std::runtime_error (
+                "IntrusivePCE: iterative solver did not converge"
+            );
+
+        }
+
+        Eigen::Map<VectorXC> coeffs ( 
+            Coeffs_.data(), nDOFs * nBasis 
+        );
+
+        coeffs = x;
+
+    }
+
+} // Mass Spring Damper Intrusive PCE matrix-free solver 
+
+namespace MassSpringDamper::Surrogate {
+
+    VectorC IntrusivePCE::ComputeResponse ( const VectorC& X ) const {
+
+        VectorC Response ( SDModel_ -> Dim () * ( X.size() / Dim_ ) );
+
+        Workspace Work;
+
+        ComputeResponse ( X, Response.data(), Work );
+
+        return Response;
+
+    }
+
+
+    VectorC IntrusivePCE::ComputeResponse ( const VectorR& X ) const {
+
+        VectorC Response ( SDModel_ -> Dim () * ( X.size() / Dim_ ) );
+
+        Workspace Work;
+
+        ComputeResponse ( X, Response.data(), Work );
+
+        return Response;
+
+    }
+
+
+    void IntrusivePCE::ComputeResponse ( 
+
+        const VectorC& X, C* Response, Workspace& Work 
+
+    ) const {
+
+        EvaluateTiles ( X.data(), X.size() / Dim_, Response, Work );
+
+    }
+
+
+    void IntrusivePCE::ComputeResponse ( 
+
+        const VectorR& X, C* Response, Workspace& Work 
+
+    ) const {
+
+        EvaluateTiles ( X.data(), X.size() / Dim_, Response, Work );
+
+    }
+
+} // Mass Spring Damper Intrusive PCE compute response 
+
+
+namespace MassSpringDamper::Surrogate {
+
+    void IntrusivePCE::EvaluateTiles ( 
+
+        const C* X, const Z nPoints, C* Response, Workspace& Work 
+
+    ) const {
+
+        auto nBasis = Indices_.size() / Dim_;
+        auto nDOFs  = SDModel_ -> Dim ();
+
+        Z Tile = ( TileSize_ == 0 || TileSize_ > nPoints ) ? nPoints : TileSize_;
+
+
+        // ===================================================================
+        // Map vectors to eigen objects for linear algebra operations 
+        // ===================================================================
+
+        Eigen::Map<const MatrixXC> coeffs (
+            Coeffs_.data(), nDOFs, nBasis 
+        );
+
+        Eigen::Map<MatrixXC> response ( 
+            Response, nDOFs, nPoints 
+        );
+
+        // Tile buffer is reused, sized for the largest tile 
+        Work.Basis.resize ( nBasis * Tile );
+
+
+        // ===================================================================
+        // Approximate response as linear combination of basis functions, 
+        // one tile of points at a time 
+        // ===================================================================
+
+        for ( Z i0 = 0; i0 < nPoints; i0 += Tile ) {
+
+            auto nTile = std::min ( Tile, nPoints - i0 );
+
+            BasisFunctions::HermitePolynomials<Z,R,C> (
+
+                Indices_, X + i0 * Dim_, nTile, Dim_, 
+                Work.Basis.data(), Work.Scratch 
+
+            );
+
+            Eigen::Map<MatrixXC> basis ( 
+                Work.Basis.data(), nBasis , nTile
+            );
+
+            response.middleCols ( i0, nTile ).noalias() = coeffs * basis;
+
+        }
+
+    }
+
+
+    void IntrusivePCE::EvaluateTiles ( 
+
+        const R* X, const Z nPoints, C* Response, Workspace& Work 
+
+    ) const {
+
+        auto nBasis = Indices_.size() / Dim_;
+        auto nDOFs  = SDModel_ -> Dim ();
+
+        Z Tile = ( TileSize_ == 0 || TileSize_ > nPoints ) ? nPoints : TileSize_;
+
+        Eigen::Map<const MatrixXC> coeffs (
+            Coeffs_.data(), nDOFs, nBasis 
+        );
+
+        Eigen::Map<MatrixXC> response ( 
+            Response, nDOFs, nPoints 
+        );
+
+        // Tile buffers are reused, sized for the largest tile 
+        auto& Args  = Work.Args;
+        auto& Basis = Work.RealBasis;
+
+        Args .resize ( Dim_ * Tile );
+        Basis.resize ( nBasis * Tile );
+
+        for ( Z i0 = 0; i0 < nPoints; i0 += Tile ) {
+
+            auto nTile = std::min ( Tile, nPoints - i0 );
+
+            // Real arguments give real basis functions, evaluated in blocks 
+            // of samples from dimension-major arguments 
+            for ( auto i = 0; i < nTile; i++ ) {
+            for ( auto m = 0; m < Dim_; m++ ) {
+
+                Args[m*nTile+i] = X[(i0+i)*Dim_+m];
+
+            }
+            }
+
+            BasisFunctions::HermitePolynomialsBatch<Z,R> ( 
+                Indices_, Args.data(), nTile, Dim_, Basis.data(), 
+                Work.RealScratch 
+            );
+
+            Eigen::Map<MatrixXR> basis ( 
+                Basis.data(), nBasis , nTile
+            );
+
+            response.middleCols ( i0, nTile ).noalias() = coeffs * basis;
+
+        }
+
+    }
+
+} // Mass Spring Damper Intrusive PCE evaluate tiles 
+
+
+namespace MassSpringDamper::Surrogate {
+
+    void IntrusivePCE::AccumulateResponse ( 
+
+        const VectorC& X, StreamingStatistics& Stats 
+
+    ) const {
+
+        AccumulateTiles<C> ( X, Stats );
+
+    }
+
+
+    void IntrusivePCE::AccumulateResponse ( 
+
+        const VectorR& X, StreamingStatistics& Stats 
+
+    ) const {
+
+        AccumulateTiles<R> ( X, Stats );
+
+    }
+
+
+    template < typename T >
+    void IntrusivePCE::AccumulateTiles ( 
+
+        const std::vector<T>& X, StreamingStatistics& Stats 
+
+    ) const {
+
+        Z nPoints = X.size() / Dim_;
+        Z nDOFs   = SDModel_ -> Dim ();
+
+        Z Tile = ( TileSize_ == 0 || TileSize_ > nPoints ) ? nPoints : TileSize_;
+
+        // responses of one tile, reused by every tile 
+        VectorC Response ( nDOFs * Tile );
+
+        Workspace Work;
+
+        for ( Z i0 = 0; i0 < nPoints; i0 += Tile ) {
+
+            auto nTile = std::min ( Tile, nPoints - i0 );
+
+            EvaluateTiles ( X.data() + i0 * Dim_, nTile, Response.data(), Work );
+
+            Stats.Add ( Response.data(), nTile );
+
+        }
+
+    }
+
+} // Mass Spring Damper Intrusive PCE accumulate response 
+
+
+namespace MassSpringDamper::Surrogate {
+
+    std::pair<VectorC, VectorR> IntrusivePCE::Statistics () const {
+
+        auto nBasis = Indices_.size() / Dim_;
+        auto nDOFs  = SDModel_ -> Dim ();
+
+        if ( Coeffs_.size() != nDOFs * nBasis || nBasis == 0 ) {
+
+            throw std::runtime_error (
+                "IntrusivePCE: model must be trained before statistics"
+            );
+
+        }
+
+        VectorC Mean     ( nDOFs, 0.0 );
+        VectorR Variance ( nDOFs, 0.0 );
+
+        for ( auto k = 0; k < nBasis; k++ ) {
+
+            bool Constant = std::all_of ( 
+                Indices_.begin() + k * Dim_, 
+                Indices_.begin() + ( k + 1 ) * Dim_, 
+                [] ( const auto i ) { return i == 0; } 
+            );
+
+            for ( auto j = 0; j < nDOFs; j++ ) {
+
+                if ( Constant ) {
+
+                    Mean[j] += Coeffs_[j+k*nDOFs];
+
+                } else {
+
+                    Variance[j] += std::norm ( Coeffs_[j+k*nDOFs] );
+
+                }
+
+            }
+
+        }
+
+        return { Mean, Variance };
+
+    }
+
+} // Mass Spring Damper Intrusive PCE statistics 
+
+
+namespace MassSpringDamper::Surrogate {
+
+    VectorR IntrusivePCE::SensitivityIndices ( const bool Total ) const {
+
+        auto nBasis = Indices_.size() / Dim_;
+        auto nDOFs  = SDModel_ -> Dim ();
+
+        auto Variance = Statistics().second;
+
+        VectorR Indices ( nDOFs * Dim_, 0.0 );
+
+        for ( auto k = 0; k < nBasis; k++ ) {
+
+            auto Set = Indices_.begin() + k * Dim_;
+
+            auto nActive = std::count_if ( 
+                Set, Set + Dim_, [] ( const auto i ) { return i != 0; } 
+            );
+
+            if ( nActive == 0 || ( !Total && nActive > 1 ) ) continue;
+
+            for ( auto m = 0; m < Dim_; m++ ) {
+
+                if ( Set[m] == 0 ) continue;
+
+                for ( auto j = 0; j < nDOFs; j++ ) {
+
+                    Indices[j+m*nDOFs] += std::norm ( Coeffs_[j+k*nDOFs] );
+
+                }
+
+            }
+
+        }
+
+        for ( auto m = 0; m < Dim_; m++ ) {
+        for ( auto j = 0; j < nDOFs; j++ ) {
+
+            Indices[j+m*nDOFs] = Variance[j] > 0.0 ? 
+                Indices[j+m*nDOFs] / Variance[j] : 0.0;
+
+        }
+        }
+
+        return Indices;
+
+    }
+
+} // Mass Spring Damper Intrusive PCE sensitivity indices 
 
 
 
@@ -28,6 +28,73 @@ namespace Analytical {
     using Vector = std::vector<T>;
 
 
+    template < typename Z, typename C >
+    /**
+      * @brief 
+      * Solve tridiagonal system A x = b in O(n) by Gaussian elimination 
+      * with partial pivoting, same algorithm as LAPACK gtsv. @n 
+      * Implemented in @ref _Tridiagonal_imp_hpp_ 
+      * 
+      * @tparam Z a type of non-negative integer e.g. size_t 
+      * @tparam C a type of floating (complex) number e.g. std::complex<float> 
+      * 
+      * @param Band band of A { Sub, Diag, Super }, each of size n, 
+      *             Sub[i] = A(i,i-1) and Super[i] = A(i,i+1) 
+      * @param Rhs  right hand side b 
+      * 
+      * @return solution x 
+      */
+    Vector<C> SolveTridiagonal ( const Vector<C>& Band, const Vector<C>& Rhs );
+
+
+    template < typename Z, typename C >
+    /**
+      * @brief 
+      * In-place variant of @ref SolveTridiagonal. Bands are overwritten by 
+      * the factorization and Rhs by the solution. 
+      * 
+      * @param n     number of equations 
+      * @param Sub   n - 1 sub-diagonal entries A(i+1,i) 
+      * @param Diag  n diagonal entries 
+      * @param Super n - 1 super-diagonal entries A(i,i+1) 
+      * @param Rhs   n right hand side entries 
+      */
+    void SolveTridiagonal ( const Z n, C* Sub, C* Diag, C* Super, C* Rhs );
+
+
+    template < typename Z, typename R >
+    /**
+      * @brief 
+      * Solve a batch of complex symmetric tridiagonal systems by the Thomas 
+      * algorithm, one system per lane. Entry i of system l is stored at 
+      * i * nBatch + l with real and imaginary parts in separate arrays, 
+      * so the lane loops vectorize. No pivoting, intended for damped 
+      * dynamic stiffness; use @ref SolveTridiagonal otherwise. @n 
+      * Implemented in @ref _Tridiagonal_imp_hpp_ 
+      * 
+      * @tparam Z a type of non-negative integer e.g. size_t 
+      * @tparam R a type of floating number e.g. double 
+      * 
+      * @param n      number of equations of each system 
+      * @param nBatch number of systems 
+      * @param OffRe  off-diagonal A(i,i+1) = A(i+1,i), overwritten 
+      * @param OffIm  imaginary part of the off-diagonal, overwritten 
+      * @param DiagRe diagonal, overwritten 
+      * @param DiagIm imaginary part of the diagonal, overwritten 
+      * @param RhsRe  right hand sides, overwritten by solutions 
+      * @param RhsIm  imaginary part of right hand sides and solutions 
+      */
+    void SolveTridiagonalBatch ( 
+
+        const Z n, 
+        const Z nBatch, 
+        R* OffRe,  R* OffIm, 
+        R* DiagRe, R* DiagIm, 
+        R* RhsRe,  R* RhsIm 
+
+    );
+
+
     template < typename Z, typename R, typename C > 
     /**
       * @class Model 
@@ -76,6 +143,10 @@ namespace Analytical {
     }; // Model 
 
 
+    template < typename Z, typename R, typename C > 
+    class ModalSolver;
+
+
     template < typename Z, typename R, typename C > 
     /**
       * @class MassSpringDamper 
@@ -90,14 +161,29 @@ namespace Analytical {
       */
     class MassSpringDamper final : public Model<Z,R,C> {
 
-        Vector<R> MassMatrix_;
-        Vector<R> DampingMatrix_;
-        Vector<R> StiffnessMatrix_;
+        // tridiagonal bands { Sub, Diag, Super }, each of size Dim 
+        Vector<R> MassBand_;
+        Vector<R> DampingBand_;
+        Vector<R> StiffnessBand_;
 
         Z Dim_;
 
         public:
 
+        /**
+          * @brief 
+          * Scratch bands of @ref ComputeResponse. Buffers grow on first use 
+          * and are reused by later calls, so a sampling loop allocates 
+          * nothing after the first sample. 
+          */
+        struct Workspace {
+
+            Vector<C> Sub; 
+            Vector<C> Diag; 
+            Vector<C> Super; 
+
+        };
+
         /**
           * @brief 
           * Generate a mass-spring-damper SD model. 
@@ -141,26 +227,255 @@ namespace Analytical {
 
         ) const override;
 
+        /**
+          * @brief 
+          * Compute structure response into a caller buffer without 
+          * allocating, temporaries are kept in Work. 
+          * 
+          * @param Force       harmonic load vector 
+          * @param omega       angular velocity 
+          * @param FirstSpring iterator of additional springs, either Dim 
+          *                    springs or an empty range 
+          * @param LastSpring  iterator of additional springs 
+          * @param Response    output of Dim displacements, may alias Force 
+          * @param Work        reusable scratch bands 
+          */
+        void ComputeResponse ( 
+
+            const Vector<C>& Force, 
+            const R omega,
+            const typename Vector<R>::const_iterator FirstSpring, 
+            const typename Vector<R>::const_iterator LastSpring, 
+            C* Response, 
+            Workspace& Work 
+
+        ) const;
+
+        /**
+          * @brief 
+          * Frequency response of the default parameters over a grid of 
+          * angular velocities. Stored bands are shared by all frequencies, 
+          * each frequency is an O(Dim) banded solve and frequencies are 
+          * split over OpenMP threads writing disjoint columns, so results 
+          * do not depend on the number of threads. 
+          * 
+          * @param Force   harmonic load vector 
+          * @param Omegas  angular velocities 
+          * @param Threads number of threads, 0 for all available, ignored 
+          *                when compiled without OpenMP 
+          * 
+          * @return Dim x nOmegas responses, column-major 
+          *         { Omega1 of all dofs, Omega2 of all dofs, ... } 
+          */
+        Vector<C> FrequencySweep ( 
+
+            const Vector<C>& Force, 
+            const Vector<R>& Omegas, 
+            const Z Threads = 0 
+
+        ) const;
+
+        /**
+          * @brief 
+          * Variant of @ref FrequencySweep writing into a caller buffer 
+          * 
+          * @param Response output of Dim x nOmegas responses 
+          */
+        void FrequencySweep ( 
+
+            const Vector<C>& Force, 
+            const R* Omegas, 
+            const Z nOmegas, 
+            C* Response, 
+            const Z Threads = 0 
+
+        ) const;
+
         Vector<R> StiffnessMatrix ( const Vector<R>& Springs ) const override;
 
         Vector<C> DynamicStiffness ( const R omega ) const override;
         Vector<R> MassMatrix      ( const Vector<R>& Masses  ) const;
         Vector<R> DampingMatrix   ( const Vector<R>& Dampers ) const;
 
-        private: 
+        /**
+          * @brief 
+          * Tridiagonal bands { Sub, Diag, Super } of the chain matrices, 
+          * each band has Dim entries, Sub[0] and Super[Dim-1] are zero. 
+          */
+        Vector<R> MassBand      ( const Vector<R>& Masses  ) const;
+        Vector<R> DampingBand   ( const Vector<R>& Dampers ) const;
+        Vector<R> StiffnessBand ( const Vector<R>& Springs ) const;
+
+        /**
+          * @brief 
+          * Stored bands of the default parameters 
+          */
+        const Vector<R>& MassBand      () const { return MassBand_; }
+        const Vector<R>& DampingBand   () const { return DampingBand_; }
+        const Vector<R>& StiffnessBand () const { return StiffnessBand_; }
+
+        /**
+          * @brief 
+          * Dynamic stiffness K - omega^2 M + i omega C in band storage 
+          * 
+          * @param omega angular velocity 
+          * 
+          * @return bands { Sub, Diag, Super }, each of size Dim 
+          */
+        Vector<C> DynamicStiffnessBand ( const R omega ) const;
+
+        /**
+          * @brief 
+          * Dynamic stiffness K - omega^2 M + i omega C of given chain 
+          * parameters in band storage, assembled in one fused pass without 
+          * the dense mass, damping and stiffness matrices. 
+          * 
+          * @param omega   angular velocity 
+          * @param Masses  Dim point masses 
+          * @param Dampers Dim damping coefficients 
+          * @param Springs Dim spring stiffnesses 
+          * @param Band    output bands { Sub, Diag, Super }, each of size Dim 
+          */
+        void AssembleDynamicStiffness ( 
 
+            const R omega, 
+            const R* Masses, 
+            const R* Dampers, 
+            const R* Springs, 
+            C* Band 
 
-        Vector<C> DynamicStiffness ( 
-            const R omega, const Vector<R>& AdditionalSprings 
         ) const;
 
+        private: 
+
+        // modal decomposition reads the stored bands 
+        friend class ModalSolver<Z,R,C>;
+
     };
 
+
+    /**
+      * @brief 
+      * Treatment of damping in modal coordinates. Proportional keeps only 
+      * the diagonal of the modal damping matrix, which is exact when the 
+      * damping is classical, e.g. dampers proportional to springs. 
+      * NonProportional keeps the coupled modal damping matrix and solves 
+      * a dense nModes system per frequency. 
+      */
+    enum class ModalDamping { Proportional, NonProportional };
+
+
+    template < typename Z, typename R, typename C > 
+    /**
+      * @class ModalSolver 
+      * 
+      * @brief 
+      * Modal superposition backend of @ref MassSpringDamper for the default 
+      * parameters. K phi = lambda M phi is solved once as the symmetric 
+      * tridiagonal eigenproblem of M^-1/2 K M^-1/2, afterwards a response 
+      * costs O(Dim x nModes) per frequency. @n 
+      * Implemented in @ref _ModalSolver_imp_hpp_ 
+      * 
+      * @tparam Z a type of non-negative integer e.g. size_t 
+      * @tparam R a type of floating number e.g. double 
+      * @tparam C a type of floating complex number e.g. std::complex<float> 
+      */
+    class ModalSolver {
+
+        // mass-normalized modes, Dim x nModes column-major 
+        Vector<R> Modes_;
+
+        // eigenvalues lambda = omega_n^2, ascending 
+        Vector<R> Eigenvalues_;
+
+        // modal damping Phi^T C Phi, nModes x nModes column-major 
+        Vector<R> ModalDamping_;
+
+        ModalDamping Damping_;
+
+        Z Dim_;
+        Z nModes_;
+
+        public: 
+
+        /**
+          * @brief 
+          * Decompose the model into its lowest modes 
+          * 
+          * @param Model   mass-spring-damper model with positive masses 
+          * @param nModes  number of retained modes, 0 keeps all 
+          * @param Damping treatment of modal damping 
+          */
+        ModalSolver ( 
+
+            const MassSpringDamper<Z,R,C>& Model, 
+            const Z nModes = 0, 
+            const ModalDamping Damping = ModalDamping::Proportional 
+
+        );
+
+        Z Dim    () const { return Dim_; }
+        Z nModes () const { return nModes_; }
+
+        /**
+          * @brief 
+          * Undamped natural angular velocities sqrt(lambda), ascending 
+          */
+        Vector<R> Frequencies () const;
+
+        /**
+          * @brief 
+          * Mass-normalized mode shapes { Mode1, Mode2, ... } 
+          */
+        const Vector<R>& Modes () const { return Modes_; }
+
+        /**
+          * @brief 
+          * Approximate response to harmonic load from retained modes 
+          * 
+          * @param Force harmonic load vector 
+          * @param omega angular velocity 
+          * 
+          * @return displacement vector 
+          */
+        Vector<C> ComputeResponse ( const Vector<C>& Force, const R omega ) const;
+
+        /**
+          * @brief 
+          * Approximate frequency response over a grid of angular velocities. 
+          * The load is projected once, modal coordinates of all frequencies 
+          * are solved over OpenMP threads and expanded by one GEMM. 
+          * 
+          * @param Force   harmonic load vector 
+          * @param Omegas  angular velocities 
+          * @param Threads number of threads, 0 for all available 
+          * 
+          * @return Dim x nOmegas responses, column-major, same layout as 
+          *         @ref MassSpringDamper::FrequencySweep 
+          */
+        Vector<C> FrequencySweep ( 
+
+            const Vector<C>& Force, 
+            const Vector<R>& Omegas, 
+            const Z Threads = 0 
+
+        ) const;
+
+    }; // ModalSolver 
+
 } // Analytical 
 
+#ifndef TRIDIAGONAL_IMPLEMENTATIONS 
+    #include "Tridiagonal_imp.hpp" 
+#endif 
+
 #ifndef MASS_SPRING_DAMPER_IMPLEMENTATIONS 
     #include "MassSpringDamper_imp.hpp" 
 #endif 
 
+#ifndef MODAL_SOLVER_IMPLEMENTATIONS 
+    #include "ModalSolver_imp.hpp" 
+#endif 
+
 #endif // ANALYTICAL_MODEL_DECLARATIONS 
 
@@ -52,20 +52,10 @@ namespace Analytical {
 
         Dim_ = Masses.size(); 
 
-        if ( Dim_ == 1 ) {
-
-            MassMatrix_.push_back      (  Masses[0] );
-            DampingMatrix_.push_back   ( Dampers[0] );
-            StiffnessMatrix_.push_back ( Springs[0] );
-
-            return; 
-
-        }
-
-        // Use private function for conciseness 
-        MassMatrix_      = MassMatrix      ( Masses  );
-        DampingMatrix_   = DampingMatrix   ( Dampers );
-        StiffnessMatrix_ = StiffnessMatrix ( Springs );
+        // Chain matrices are tridiagonal, only the bands are stored 
+        MassBand_      = MassBand      ( Masses  );
+        DampingBand_   = DampingBand   ( Dampers );
+        StiffnessBand_ = StiffnessBand ( Springs );
 
     } // Constructor 
 
@@ -157,59 +147,158 @@ namespace Analytical {
     } // StiffnessMatrix 
 
 
-    template < typename Z, typename R, typename C >
-    Vector<C> MassSpringDamper<Z,R,C>::DynamicStiffness (
+    template < typename Z, typename R, typename C > 
+    Vector<R> MassSpringDamper<Z,R,C>::MassBand (
 
-        const R omega, const Vector<R>& AdditionalSprings 
+        const Vector<R>& Masses 
 
     ) const {
 
-        auto AdditionalStiffness = StiffnessMatrix ( AdditionalSprings );
+        auto Dim = Masses.size(); 
 
-        Vector<C> result ( Dim_ * Dim_, 0.0 );
+        Vector<R> Band ( 3 * Dim, 0.0 );
 
-        for ( auto i = 0; i < result.size(); i++ ) {
+        std::copy ( Masses.begin(), Masses.end(), Band.begin() + Dim );
 
-            result[i] = C (
+        return Band;
 
-                StiffnessMatrix_[i] + AdditionalStiffness[i] -
-                omega * omega * MassMatrix_[i]
+    } // MassBand 
 
-                , 
 
-                omega * DampingMatrix_[i]
+    template < typename Z, typename R, typename C > 
+    Vector<R> MassSpringDamper<Z,R,C>::DampingBand (
+
+        const Vector<R>& Dampers 
+
+    ) const {
+
+        // dampers connect the masses the same way as springs 
+        return StiffnessBand ( Dampers );
+
+    } // DampingBand 
 
-            );
+
+    template < typename Z, typename R, typename C > 
+    Vector<R> MassSpringDamper<Z,R,C>::StiffnessBand (
+
+        const Vector<R>& Springs 
+
+    ) const {
+
+        auto Dim = Springs.size(); 
+
+        Vector<R> Band ( 3 * Dim, 0.0 );
+
+        R* Sub   = Band.data();
+        R* Diag  = Band.data() +     Dim;
+        R* Super = Band.data() + 2 * Dim;
+
+        for ( auto i = 0; i + 1 < Dim; i++ ) {
+
+            Diag [i  ] =  Springs[i] + Springs[i+1];
+            Super[i  ] =             - Springs[i+1];
+            Sub  [i+1] =             - Springs[i+1];
 
         }
 
-        return result;
+        if ( Dim > 0 ) Diag[Dim-1] = Springs[Dim-1];
+
+        return Band;
+
+    } // StiffnessBand 
 
-    } // DynamicStiffness 
 
     template < typename Z, typename R, typename C >
-    Vector<C> MassSpringDamper<Z,R,C>::DynamicStiffness (
+    Vector<C> MassSpringDamper<Z,R,C>::DynamicStiffnessBand (
 
         const R omega
 
     ) const {
 
-        Vector<C> result ( Dim_ * Dim_, 0.0 );
+        Vector<C> result ( 3 * Dim_ );
 
         for ( auto i = 0; i < result.size(); i++ ) {
 
             result[i] = C (
 
-                StiffnessMatrix_[i] -
-                omega * omega * MassMatrix_[i]
+                StiffnessBand_[i] -
+                omega * omega * MassBand_[i]
 
                 , 
 
-                omega * DampingMatrix_[i]
+                omega * DampingBand_[i]
 
             );
 
-            // std::cout << result[i] << std::endl;
+        }
+
+        return result;
+
+    } // DynamicStiffnessBand 
+
+
+    template < typename Z, typename R, typename C >
+    void MassSpringDamper<Z,R,C>::AssembleDynamicStiffness (
+
+        const R omega, 
+        const R* Masses, 
+        const R* Dampers, 
+        const R* Springs, 
+        C* Band 
+
+    ) const {
+
+        if ( Dim_ == 0 ) return;
+
+        C* Sub   = Band;
+        C* Diag  = Band +     Dim_;
+        C* Super = Band + 2 * Dim_;
+
+        Sub  [0]      = 0.0;
+        Super[Dim_-1] = 0.0;
+
+        for ( Z i = 0; i < Dim_; i++ ) {
+
+            R c = Dampers[i];
+            R k = Springs[i];
+
+            // spring and damper i+1 couple dofs i and i+1 
+            if ( i + 1 < Dim_ ) {
+
+                c += Dampers[i+1];
+                k += Springs[i+1];
+
+                Super[i  ] = C ( -Springs[i+1], omega * -Dampers[i+1] );
+                Sub  [i+1] = Super[i];
+
+            }
+
+            Diag[i] = C ( k - omega * omega * Masses[i], omega * c );
+
+        }
+
+    } // AssembleDynamicStiffness 
+
+
+    template < typename Z, typename R, typename C >
+    Vector<C> MassSpringDamper<Z,R,C>::DynamicStiffness (
+
+        const R omega
+
+    ) const {
+
+        auto Band = DynamicStiffnessBand ( omega );
+
+        Vector<C> result ( Dim_ * Dim_, 0.0 );
+
+        // column-major, entry (i,j) at i + j * Dim 
+        for ( auto i = 0; i < Dim_; i++ ) {
+
+            if ( i > 0 ) result[i+(i-1)*Dim_] = Band[i];
+
+            result[i+i*Dim_] = Band[Dim_+i];
+
+            if ( i + 1 < Dim_ ) result[i+(i+1)*Dim_] = Band[2*Dim_+i];
 
         }
 
@@ -228,26 +317,204 @@ namespace Analytical {
 
     ) const {
 
-        Vector<C> result ( Dim_, 0.0 );
+        Vector<C> result ( Dim_ );
 
-        auto KDynamic = DynamicStiffness ( 
-            omega, Vector<R> ( FirstSpring, LastSpring ) 
+        Workspace Work;
+
+        ComputeResponse ( 
+            Force, omega, FirstSpring, LastSpring, result.data(), Work 
         );
 
-        Eigen::Map<MatrixXC<C>, Eigen::RowMajor> KD ( 
+        return result;
 
-            KDynamic.data(), Dim_, Dim_
+    } // ComputeResponse 
 
-        );
 
-        Eigen::Map<const VectorXC<C>> Load ( Force.data(), Dim_ );
-        Eigen::Map<VectorXC<C>> Disp ( result.data(), Dim_ );
+    template < typename Z, typename R, typename C >
+    void MassSpringDamper<Z,R,C>::ComputeResponse ( 
+
+        const Vector<C>& Force, 
+        const R omega, 
+        const typename Vector<R>::const_iterator FirstSpring, 
+        const typename Vector<R>::const_iterator LastSpring, 
+        C* Response, 
+        Workspace& Work 
+
+    ) const {
+
+        Z nSprings = std::distance ( FirstSpring, LastSpring );
+
+        if ( Force.size() != Dim_ ) {
+
+            throw std::runtime_error (
+                "MassSpringDamper: size of force must be equal to dimension"
+            );
+
+        }
+
+        if ( nSprings != 0 && nSprings != Dim_ ) {
+
+            throw std::runtime_error (
+                "MassSpringDamper: num of additional springs must be dimension"
+            );
+
+        }
+
+        if ( Dim_ == 0 ) return;
+
+        Work.Sub  .resize ( Dim_ );
+        Work.Diag .resize ( Dim_ );
+        Work.Super.resize ( Dim_ );
+
+        // bands of the in-place solver, Sub[i] = A(i+1,i) 
+        C* Sub   = Work.Sub.data();
+        C* Diag  = Work.Diag.data();
+        C* Super = Work.Super.data();
+
+        const R* MassBand      = MassBand_.data()      + Dim_;
+        const R* DampingBand   = DampingBand_.data();
+        const R* StiffnessBand = StiffnessBand_.data();
+
+        for ( Z i = 0; i < Dim_; i++ ) {
+
+            // additional springs couple the masses like the default ones 
+            R Added = 0.0;
+
+            if ( nSprings > 0 ) {
+
+                Added = FirstSpring[i];
 
-        Disp = KD.partialPivLu().solve ( Load );
+                if ( i + 1 < Dim_ ) Added += FirstSpring[i+1];
+
+            }
+
+            Diag[i] = C ( 
+
+                StiffnessBand[Dim_+i] + Added - omega * omega * MassBand[i], 
+                omega * DampingBand[Dim_+i] 
+
+            );
+
+            if ( i + 1 < Dim_ ) {
+
+                R AddedOff = nSprings > 0 ? -FirstSpring[i+1] : R(0);
+
+                Super[i] = C ( 
+                    StiffnessBand[2*Dim_+i] + AddedOff, 
+                    omega * DampingBand[2*Dim_+i] 
+                );
+
+                Sub[i] = C ( 
+                    StiffnessBand[i+1] + AddedOff, 
+                    omega * DampingBand[i+1] 
+                );
+
+            }
+
+        }
+
+        // O(Dim) solve instead of dense LU 
+        if ( Response != Force.data() ) {
+
+            std::copy ( Force.begin(), Force.end(), Response );
+
+        }
+
+        SolveTridiagonal<Z,C> ( Dim_, Sub, Diag, Super, Response );
+
+    } // ComputeResponse with workspace 
+
+
+    template < typename Z, typename R, typename C >
+    Vector<C> MassSpringDamper<Z,R,C>::FrequencySweep ( 
+
+        const Vector<C>& Force, 
+        const Vector<R>& Omegas, 
+        const Z Threads 
+
+    ) const {
+
+        Vector<C> result ( Dim_ * Omegas.size() );
+
+        FrequencySweep ( 
+            Force, Omegas.data(), Omegas.size(), result.data(), Threads 
+        );
 
         return result;
 
-    } // ComputeResponse 
+    } // FrequencySweep 
+
+
+    template < typename Z, typename R, typename C >
+    void MassSpringDamper<Z,R,C>::FrequencySweep ( 
+
+        const Vector<C>& Force, 
+        const R* Omegas, 
+        const Z nOmegas, 
+        C* Response, 
+        const Z Threads 
+
+    ) const {
+
+        if ( Force.size() != Dim_ ) {
+
+            throw std::runtime_error (
+                "MassSpringDamper: size of force must be equal to dimension"
+            );
+
+        }
+
+#ifdef _OPENMP
+        int nThreads = Threads > 0 ? Threads : omp_get_max_threads();
+#else
+        (void) Threads;
+#endif
+
+        // no additional springs 
+        const Vector<R> None;
+
+        bool Failed = false;
+
+        #pragma omp parallel num_threads ( nThreads )
+        {
+
+        // bands of one frequency, reused by all frequencies of a thread 
+        Workspace Work;
+
+        #pragma omp for schedule ( static )
+        for ( Z w = 0; w < nOmegas; w++ ) {
+
+            // exceptions must not leave the parallel region 
+            try {
+
+                ComputeResponse ( 
+
+                    Force, Omegas[w], 
+                    None.cbegin(), None.cend(), 
+                    Response + w * Dim_, Work 
+
+                );
+
+            } catch ( const std::runtime_error& ) {
+
+                #pragma omp atomic write 
+                Failed = true;
+
+            }
+
+        }
+
+        } // omp parallel 
+
+        if ( Failed ) {
+
+            throw std::runtime_error (
+                "MassSpringDamper: singular dynamic stiffness in sweep"
+            );
+
+        }
+
+    } // FrequencySweep into buffer 
 
 } // Analytical : MassSpringDamper 
 
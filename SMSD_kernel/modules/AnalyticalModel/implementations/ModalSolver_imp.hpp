@@ -0,0 +1,318 @@
+/**
+  * @file ModalSolver_imp.hpp 
+  *
+  * @brief 
+  * Implementations of modal superposition solver of Mass-Spring-Damper model 
+  *
+  * @anchor _ModalSolver_imp_hpp_ 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#ifndef MODAL_SOLVER_IMPLEMENTATIONS 
+#define MODAL_SOLVER_IMPLEMENTATIONS 
+
+#ifndef ANALYTICAL_MODEL_DECLARATIONS 
+    #include "AnalyticalModel.hpp" 
+#endif 
+
+
+namespace Analytical {
+
+    template < typename Z, typename R, typename C >
+    ModalSolver<Z,R,C>::ModalSolver (
+
+        const MassSpringDamper<Z,R,C>& Model,
+        const Z nModes,
+        const ModalDamping Damping
+
+    ) : Damping_ ( Damping ), Dim_ ( Model.Dim_ ) {
+
+        typedef Eigen::Matrix<R, Eigen::Dynamic, Eigen::Dynamic> MatrixXR;
+        typedef Eigen::Vector<R, Eigen::Dynamic> VectorXR;
+
+        auto n = Dim_;
+
+        if ( n == 0 ) {
+
+            throw std::runtime_error (
+                "ModalSolver: model must have at least one degree of freedom"
+            );
+
+        }
+
+        if ( nModes > n ) {
+
+            throw std::runtime_error (
+                "ModalSolver: more modes than degrees of freedom"
+            );
+
+        }
+
+        nModes_ = nModes == 0 ? n : nModes;
+
+        const R* Masses = Model.MassBand_.data() + n;
+
+        const R* KSub  = Model.StiffnessBand_.data();
+        const R* KDiag = Model.StiffnessBand_.data() +     n;
+
+        const R* CSub   = Model.DampingBand_.data();
+        const R* CDiag  = Model.DampingBand_.data() +     n;
+        const R* CSuper = Model.DampingBand_.data() + 2 * n;
+
+
+        // =================================================================== 
+        // Symmetric tridiagonal M^-1/2 K M^-1/2, mass matrix is diagonal 
+        // =================================================================== 
+
+        VectorXR Scale ( n ), Diag ( n ), Sub ( n - 1 );
+
+        for ( Z i = 0; i < n; i++ ) {
+
+            if ( !( Masses[i] > 0.0 ) ) {
+
+                throw std::runtime_error (
+                    "ModalSolver: masses must be positive"
+                );
+
+            }
+
+            Scale[i] = 1.0 / std::sqrt ( Masses[i] );
+
+        }
+
+        for ( Z i = 0; i < n; i++ ) {
+
+            Diag[i] = KDiag[i] * Scale[i] * Scale[i];
+
+            if ( i + 1 < n ) Sub[i] = KSub[i+1] * Scale[i] * Scale[i+1];
+
+        }
+
+        Eigen::SelfAdjointEigenSolver<MatrixXR> Solver;
+
+        Solver.computeFromTridiagonal ( Diag, Sub, Eigen::ComputeEigenvectors );
+
+        if ( Solver.info() != Eigen::Success ) {
+
+            throw std::runtime_error (
+                "ModalSolver: eigenvalue decomposition failed"
+            );
+
+        }
+
+
+        // =================================================================== 
+        // Lowest modes, phi = M^-1/2 psi is mass-normalized 
+        // =================================================================== 
+
+        Eigenvalues_.resize ( nModes_ );
+        Modes_.resize ( n * nModes_ );
+
+        for ( Z r = 0; r < nModes_; r++ ) {
+
+            Eigenvalues_[r] = Solver.eigenvalues()[r];
+
+            for ( Z i = 0; i < n; i++ ) {
+
+                Modes_[i+r*n] = Scale[i] * Solver.eigenvectors()(i,r);
+
+            }
+
+        }
+
+
+        // =================================================================== 
+        // Modal damping Phi^T C Phi from the damping bands 
+        // =================================================================== 
+
+        Eigen::Map<const MatrixXR> modes ( Modes_.data(), n, nModes_ );
+
+        MatrixXR DampedModes ( n, nModes_ );
+
+        for ( Z r = 0; r < nModes_; r++ ) {
+        for ( Z i = 0; i < n; i++ ) {
+
+            R value = CDiag[i] * modes(i,r);
+
+            if ( i > 0     ) value += CSub  [i] * modes(i-1,r);
+            if ( i + 1 < n ) value += CSuper[i] * modes(i+1,r);
+
+            DampedModes(i,r) = value;
+
+        }
+        }
+
+        ModalDamping_.resize ( nModes_ * nModes_ );
+
+        Eigen::Map<MatrixXR> modalDamping (
+            ModalDamping_.data(), nModes_, nModes_
+        );
+
+        modalDamping.noalias() = modes.transpose() * DampedModes;
+
+    } // Constructor 
+
+
+    template < typename Z, typename R, typename C >
+    Vector<R> ModalSolver<Z,R,C>::Frequencies () const {
+
+        Vector<R> result ( nModes_ );
+
+        for ( Z r = 0; r < nModes_; r++ ) {
+
+            // round-off may give tiny negative rigid body eigenvalues 
+            result[r] = std::sqrt ( std::max ( Eigenvalues_[r], R(0) ) );
+
+        }
+
+        return result;
+
+    } // Frequencies 
+
+
+    template < typename Z, typename R, typename C >
+    Vector<C> ModalSolver<Z,R,C>::ComputeResponse (
+
+        const Vector<C>& Force, const R omega
+
+    ) const {
+
+        return FrequencySweep ( Force, Vector<R> { omega }, 1 );
+
+    } // ComputeResponse 
+
+
+    template < typename Z, typename R, typename C >
+    Vector<C> ModalSolver<Z,R,C>::FrequencySweep (
+
+        const Vector<C>& Force,
+        const Vector<R>& Omegas,
+        const Z Threads
+
+    ) const {
+
+        typedef Eigen::Matrix<R, Eigen::Dynamic, Eigen::Dynamic> MatrixXR;
+
+        if ( Force.size() != Dim_ ) {
+
+            throw std::runtime_error (
+                "ModalSolver: size of force must be equal to dimension"
+            );
+
+        }
+
+        Z nOmegas = Omegas.size();
+
+        Eigen::Map<const MatrixXR> modes ( Modes_.data(), Dim_, nModes_ );
+
+        Eigen::Map<const MatrixXR> modalDamping (
+            ModalDamping_.data(), nModes_, nModes_
+        );
+
+        Eigen::Map<const VectorXC<C>> force ( Force.data(), Dim_ );
+
+        // modal load is the same for every frequency 
+        VectorXC<C> ModalForce = modes.transpose() * force;
+
+        MatrixXC<C> Coordinates ( nModes_, nOmegas );
+
+#ifdef _OPENMP 
+        int nThreads = Threads > 0 ? Threads : omp_get_max_threads();
+#else 
+        (void) Threads;
+#endif 
+
+        bool Failed = false;
+
+        #pragma omp parallel num_threads ( nThreads )
+        {
+
+        // coupled modal system of one frequency, reused by a thread 
+        MatrixXC<C> Stiffness;
+        Eigen::PartialPivLU<MatrixXC<C>> LU;
+
+        if ( Damping_ == ModalDamping::NonProportional ) {
+
+            Stiffness.resize ( nModes_, nModes_ );
+
+        }
+
+        #pragma omp for schedule ( static )
+        for ( Z w = 0; w < nOmegas; w++ ) {
+
+            R omega = Omegas[w];
+
+            if ( Damping_ == ModalDamping::Proportional ) {
+
+                for ( Z r = 0; r < nModes_; r++ ) {
+
+                    C Pivot (
+                        Eigenvalues_[r] - omega * omega,
+                        omega * modalDamping(r,r)
+                    );
+
+                    if ( Pivot == C(0) ) {
+
+                        #pragma omp atomic write 
+                        Failed = true;
+
+                    }
+
+                    Coordinates(r,w) = ModalForce[r] / Pivot;
+
+                }
+
+                continue;
+
+            }
+
+            // lambda - omega^2 + i omega Phi^T C Phi 
+            Stiffness.real().setZero();
+            Stiffness.imag() = omega * modalDamping;
+
+            for ( Z r = 0; r < nModes_; r++ ) {
+
+                Stiffness(r,r) += Eigenvalues_[r] - omega * omega;
+
+            }
+
+            LU.compute ( Stiffness );
+
+            if ( LU.determinant() == C(0) ) {
+
+                #pragma omp atomic write 
+                Failed = true;
+
+            }
+
+            Coordinates.col(w) = LU.solve ( ModalForce );
+
+        }
+
+        } // omp parallel 
+
+        if ( Failed ) {
+
+            throw std::runtime_error (
+                "ModalSolver: singular modal dynamic stiffness"
+            );
+
+        }
+
+        Vector<C> result ( Dim_ * nOmegas );
+
+        Eigen::Map<MatrixXC<C>> response ( result.data(), Dim_, nOmegas );
+
+        // superposition of all frequencies in one real x complex GEMM 
+        response.noalias() = modes * Coordinates;
+
+        return result;
+
+    } // FrequencySweep 
+
+} // Analytical : ModalSolver 
+
+#endif // MODAL_SOLVER_IMPLEMENTATIONS 
@@ -0,0 +1,251 @@
+/**
+  * @file Tridiagonal_imp.hpp 
+  *
+  * @brief 
+  * Implementations of tridiagonal linear solver 
+  * 
+  * @anchor _Tridiagonal_imp_hpp_ 
+  * 
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#ifndef TRIDIAGONAL_IMPLEMENTATIONS 
+#define TRIDIAGONAL_IMPLEMENTATIONS 
+
+#ifndef ANALYTICAL_MODEL_DECLARATIONS 
+    #include "AnalyticalModel.hpp" 
+#endif 
+
+
+namespace Analytical {
+
+    template < typename Z, typename C >
+    Vector<C> SolveTridiagonal ( const Vector<C>& Band, const Vector<C>& Rhs ) {
+
+        Z n = Rhs.size();
+
+        if ( Band.size() != 3 * n ) {
+
+            throw std::runtime_error (
+                "SolveTridiagonal: band size must be three times rhs size"
+            );
+
+        }
+
+        if ( n == 0 ) return Vector<C> ();
+
+        // Sub[0] and Super[n-1] are outside of the matrix 
+        Vector<C> Sub   ( Band.begin() +         1, Band.begin() +     n );
+        Vector<C> Diag  ( Band.begin() +     n,     Band.begin() + 2 * n );
+        Vector<C> Super ( Band.begin() + 2 * n,     Band.begin() + 3 * n );
+
+        Vector<C> result = Rhs;
+
+        SolveTridiagonal<Z,C> ( 
+            n, Sub.data(), Diag.data(), Super.data(), result.data() 
+        );
+
+        return result;
+
+    } // SolveTridiagonal 
+
+
+    template < typename Z, typename C >
+    void SolveTridiagonal ( const Z n, C* Sub, C* Diag, C* Super, C* Rhs ) {
+
+        if ( n == 0 ) return;
+
+        // Forward elimination, rows i and i+1 are swapped when the 
+        // sub-diagonal entry is larger. A swap fills the second 
+        // super-diagonal, stored in place of the eliminated Sub[i] 
+        for ( Z i = 0; i + 1 < n; i++ ) {
+
+            if ( std::abs ( Diag[i] ) >= std::abs ( Sub[i] ) ) {
+
+                if ( Diag[i] == C(0) ) {
+
+                    throw std::runtime_error (
+                        "SolveTridiagonal: matrix is singular"
+                    );
+
+                }
+
+                C fact = Sub[i] / Diag[i];
+
+                Diag[i+1] -= fact * Super[i];
+                Rhs [i+1] -= fact * Rhs[i];
+
+                Sub[i] = 0;
+
+            } else {
+
+                C fact = Diag[i] / Sub[i];
+
+                Diag[i] = Sub[i];
+
+                C temp = Diag[i+1];
+
+                Diag[i+1] = Super[i] - fact * temp;
+
+                if ( i + 2 < n ) {
+
+                    Sub  [i  ] = Super[i+1];
+                    Super[i+1] = -fact * Sub[i];
+
+                }
+
+                Super[i] = temp;
+
+                temp = Rhs[i];
+
+                Rhs[i  ] = Rhs[i+1];
+                Rhs[i+1] = temp - fact * Rhs[i+1];
+
+            }
+
+        }
+
+        if ( Diag[n-1] == C(0) ) {
+
+            throw std::runtime_error (
+                "SolveTridiagonal: matrix is singular"
+            );
+
+        }
+
+        // Back substitution with up to two super-diagonals 
+        Rhs[n-1] /= Diag[n-1];
+
+        for ( Z i = n - 1; i-- > 0; ) {
+
+            Rhs[i] -= Super[i] * Rhs[i+1];
+
+            if ( i + 2 < n ) Rhs[i] -= Sub[i] * Rhs[i+2];
+
+            Rhs[i] /= Diag[i];
+
+        }
+
+    } // SolveTridiagonal in-place 
+
+
+
+    template < typename Z, typename R >
+    void SolveTridiagonalBatch ( 
+
+        const Z n, 
+        const Z nBatch, 
+        R* OffRe,  R* OffIm, 
+        R* DiagRe, R* DiagIm, 
+        R* RhsRe,  R* RhsIm 
+
+    ) {
+
+        if ( n == 0 ) return;
+
+        // Forward sweep, Off becomes c'_i = Off_i / pivot_i and Rhs becomes 
+        // d'_i = ( Rhs_i - Off_{i-1} d'_{i-1} ) / pivot_i 
+        for ( Z i = 0; i < n; i++ ) {
+
+            R* pRe = DiagRe + i * nBatch;
+            R* pIm = DiagIm + i * nBatch;
+            R* bRe = RhsRe  + i * nBatch;
+            R* bIm = RhsIm  + i * nBatch;
+
+            if ( i > 0 ) {
+
+                const R* aRe = OffRe + ( i - 1 ) * nBatch;
+                const R* aIm = OffIm + ( i - 1 ) * nBatch;
+
+                // original off-diagonal, kept in the Diag slot of row i-1 
+                const R* oRe = DiagRe + ( i - 1 ) * nBatch;
+                const R* oIm = DiagIm + ( i - 1 ) * nBatch;
+
+                const R* dRe = RhsRe + ( i - 1 ) * nBatch;
+                const R* dIm = RhsIm + ( i - 1 ) * nBatch;
+
+                for ( Z l = 0; l < nBatch; l++ ) {
+
+                    // pivot -= Off_{i-1} * c'_{i-1} 
+                    pRe[l] -= oRe[l] * aRe[l] - oIm[l] * aIm[l];
+                    pIm[l] -= oRe[l] * aIm[l] + oIm[l] * aRe[l];
+
+                    // rhs -= Off_{i-1} * d'_{i-1} 
+                    bRe[l] -= oRe[l] * dRe[l] - oIm[l] * dIm[l];
+                    bIm[l] -= oRe[l] * dIm[l] + oIm[l] * dRe[l];
+
+                }
+
+            }
+
+            R* cRe = OffRe + i * nBatch;
+            R* cIm = OffIm + i * nBatch;
+
+            bool Singular = false;
+
+            for ( Z l = 0; l < nBatch; l++ ) {
+
+                R Norm = pRe[l] * pRe[l] + pIm[l] * pIm[l];
+
+                Singular |= ( Norm == R(0) );
+
+                // 1 / pivot = conj(pivot) / |pivot|^2 
+                R invRe =  pRe[l] / Norm;
+                R invIm = -pIm[l] / Norm;
+
+                R re = bRe[l] * invRe - bIm[l] * invIm;
+                R im = bRe[l] * invIm + bIm[l] * invRe;
+
+                bRe[l] = re; 
+                bIm[l] = im;
+
+                // keep Off_i for the next row, store c'_i in its place 
+                R oRe = cRe[l];
+                R oIm = cIm[l];
+
+                cRe[l] = oRe * invRe - oIm * invIm;
+                cIm[l] = oRe * invIm + oIm * invRe;
+
+                pRe[l] = oRe;
+                pIm[l] = oIm;
+
+            }
+
+            if ( Singular ) {
+
+                throw std::runtime_error (
+                    "SolveTridiagonalBatch: zero pivot"
+                );
+
+            }
+
+        }
+
+        // Back substitution x_i = d'_i - c'_i x_{i+1} 
+        for ( Z i = n - 1; i-- > 0; ) {
+
+            const R* cRe = OffRe + i * nBatch;
+            const R* cIm = OffIm + i * nBatch;
+
+            const R* xRe = RhsRe + ( i + 1 ) * nBatch;
+            const R* xIm = RhsIm + ( i + 1 ) * nBatch;
+
+            R* bRe = RhsRe + i * nBatch;
+            R* bIm = RhsIm + i * nBatch;
+
+            for ( Z l = 0; l < nBatch; l++ ) {
+
+                bRe[l] -= cRe[l] * xRe[l] - cIm[l] * xIm[l];
+                bIm[l] -= cRe[l] * xIm[l] + cIm[l] * xRe[l];
+
+            }
+
+        }
+
+    } // SolveTridiagonalBatch 
+
+} // Analytical : Tridiagonal 
+
+#endif // TRIDIAGONAL_IMPLEMENTATIONS 
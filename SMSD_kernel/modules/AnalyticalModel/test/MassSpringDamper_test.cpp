@@ -86,3 +86,306 @@ TEST ( MassSpringDamper, NormalModel ) {
 
 }
 
+
+
+TEST ( MassSpringDamper, BandMatchDenseSolve ) {
+
+    typedef double Float;
+    typedef std::vector<Float> Vector;
+    typedef std::complex<Float> Complex; 
+
+    typedef std::vector<Complex> VectorC;
+    typedef Eigen::Matrix<Complex, Eigen::Dynamic, Eigen::Dynamic> MatrixXC;
+    typedef Eigen::Vector<Complex, Eigen::Dynamic> VectorXC;
+
+    typedef Analytical::MassSpringDamper<size_t,Float,Complex> Model;
+
+    size_t n = 50;
+
+    Vector Masses ( n ), Dampers ( n ), Springs ( n ), AdditionalSprings ( n );
+
+    VectorC Force ( n );
+
+    for ( auto i = 0; i < n; i++ ) {
+
+        Masses [i] = 1.0 + 0.01 * i;
+        Dampers[i] = 0.05;
+        Springs[i] = 100.0 + i;
+
+        AdditionalSprings[i] = 0.5 * std::sin ( i );
+
+        Force[i] = Complex ( 1.0, 0.1 * i );
+
+    }
+
+    Float omega = 3.0;
+
+    Model SDModel ( Masses, Dampers, Springs );
+
+    auto result = SDModel.ComputeResponse ( 
+        Force, omega, AdditionalSprings.cbegin(), AdditionalSprings.cend() 
+    );
+
+    // Dense reference from the full matrices 
+    Vector TotalSprings ( n );
+
+    for ( auto i = 0; i < n; i++ ) {
+
+        TotalSprings[i] = Springs[i] + AdditionalSprings[i];
+
+    }
+
+    auto M = SDModel.MassMatrix      ( Masses       );
+    auto C = SDModel.DampingMatrix   ( Dampers      );
+    auto K = SDModel.StiffnessMatrix ( TotalSprings );
+
+    MatrixXC KD ( n, n );
+
+    for ( auto i = 0; i < n * n; i++ ) {
+
+        KD.data()[i] = Complex ( K[i] - omega * omega * M[i], omega * C[i] );
+
+    }
+
+    Eigen::Map<VectorXC> F ( Force.data(), n );
+
+    VectorXC expected = KD.partialPivLu().solve ( F );
+
+    // Dense dynamic stiffness is expanded from the bands 
+    auto K0    = SDModel.StiffnessMatrix  ( Springs );
+    auto Dense = SDModel.DynamicStiffness ( omega   );
+
+    for ( auto i = 0; i < n * n; i++ ) {
+
+        EXPECT_DOUBLE_EQ ( Dense[i].real(), K0[i] - omega * omega * M[i] );
+        EXPECT_DOUBLE_EQ ( Dense[i].imag(), omega * C[i] );
+
+    }
+
+    Float tol = 1e-10;
+
+    ASSERT_EQ ( result.size(), n );
+
+    for ( auto i = 0; i < n; i++ ) {
+
+        EXPECT_NEAR ( result[i].real(), expected(i).real(), tol );
+        EXPECT_NEAR ( result[i].imag(), expected(i).imag(), tol );
+
+    }
+
+}
+
+
+TEST ( MassSpringDamper, WorkspaceMatchByValue ) {
+
+    typedef double Float;
+    typedef std::vector<Float> Vector;
+    typedef std::complex<Float> Complex; 
+
+    typedef std::vector<Complex> VectorC;
+
+    typedef Analytical::MassSpringDamper<size_t,Float,Complex> Model;
+
+    size_t n = 20;
+
+    Vector Masses ( n, 1.5 ), Dampers ( n, 0.1 ), Springs ( n, 80.0 );
+
+    VectorC Force ( n );
+
+    for ( auto i = 0; i < n; i++ ) Force[i] = Complex ( std::cos ( i ), 0.5 );
+
+    Model SDModel ( Masses, Dampers, Springs );
+
+    Model::Workspace Work;
+
+    VectorC Response ( n );
+
+    // same workspace for every sample 
+    for ( auto s = 0; s < 5; s++ ) {
+
+        Vector AdditionalSprings ( n );
+
+        for ( auto i = 0; i < n; i++ ) {
+
+            AdditionalSprings[i] = std::sin ( 0.3 * i + s );
+
+        }
+
+        Float omega = 2.0 + s;
+
+        SDModel.ComputeResponse ( 
+
+            Force, omega, 
+            AdditionalSprings.cbegin(), AdditionalSprings.cend(), 
+            Response.data(), Work 
+
+        );
+
+        auto expected = SDModel.ComputeResponse ( 
+            Force, omega, AdditionalSprings.cbegin(), AdditionalSprings.cend() 
+        );
+
+        EXPECT_EQ ( Response, expected );
+
+    }
+
+    // empty range of additional springs solves the default model 
+    Vector Zeros ( n, 0.0 ), None;
+
+    SDModel.ComputeResponse ( 
+        Force, 3.0, None.cbegin(), None.cend(), Response.data(), Work 
+    );
+
+    auto expected = SDModel.ComputeResponse ( 
+        Force, 3.0, Zeros.cbegin(), Zeros.cend() 
+    );
+
+    EXPECT_EQ ( Response, expected );
+
+    Vector Short ( n - 1, 0.0 );
+
+    EXPECT_THROW ( 
+
+        SDModel.ComputeResponse ( 
+            Force, 3.0, Short.cbegin(), Short.cend(), Response.data(), Work 
+        ), 
+
+        std::runtime_error 
+
+    );
+
+}
+
+
+TEST ( MassSpringDamper, AssembleDynamicStiffnessMatchDense ) {
+
+    typedef double Float;
+    typedef std::vector<Float> Vector;
+    typedef std::complex<Float> Complex; 
+
+    typedef std::vector<Complex> VectorC;
+
+    typedef Analytical::MassSpringDamper<size_t,Float,Complex> Model;
+
+    size_t n = 7;
+
+    Vector Masses ( n ), Dampers ( n ), Springs ( n );
+
+    for ( auto i = 0; i < n; i++ ) {
+
+        Masses [i] = 1.0 + 0.1 * i;
+        Dampers[i] = 0.2 - 0.01 * i;
+        Springs[i] = 30.0 + 2.0 * i;
+
+    }
+
+    Float omega = 2.5;
+
+    Model SDModel ( Masses, Dampers, Springs );
+
+    VectorC Band ( 3 * n, Complex ( 9.0, 9.0 ) );
+
+    SDModel.AssembleDynamicStiffness ( 
+        omega, Masses.data(), Dampers.data(), Springs.data(), Band.data() 
+    );
+
+    // default parameters reproduce the stored bands 
+    EXPECT_EQ ( Band, SDModel.DynamicStiffnessBand ( omega ) );
+
+    auto M = SDModel.MassMatrix      ( Masses  );
+    auto C = SDModel.DampingMatrix   ( Dampers );
+    auto K = SDModel.StiffnessMatrix ( Springs );
+
+    for ( auto i = 0; i < n; i++ ) {
+    for ( auto j = 0; j < n; j++ ) {
+
+        Complex expected ( 
+            K[i+j*n] - omega * omega * M[i+j*n], omega * C[i+j*n] 
+        );
+
+        Complex entry = 0.0;
+
+        if ( j + 1 == i ) entry = Band[i];
+        if ( j     == i ) entry = Band[n+i];
+        if ( j     == i + 1 ) entry = Band[2*n+i];
+
+        EXPECT_DOUBLE_EQ ( entry.real(), expected.real() );
+        EXPECT_DOUBLE_EQ ( entry.imag(), expected.imag() );
+
+    }
+    }
+
+}
+
+
+TEST ( MassSpringDamper, FrequencySweepMatchComputeResponse ) {
+
+    typedef double Float;
+    typedef std::vector<Float> Vector;
+    typedef std::complex<Float> Complex; 
+
+    typedef std::vector<Complex> VectorC;
+
+    typedef Analytical::MassSpringDamper<size_t,Float,Complex> Model;
+
+    size_t n = 10, nOmegas = 37;
+
+    Vector Masses ( n, 2.0 ), Dampers ( n, 0.3 ), Springs ( n, 50.0 );
+
+    VectorC Force ( n, Complex ( 1.0, -0.5 ) );
+
+    Vector Omegas ( nOmegas );
+
+    for ( auto w = 0; w < nOmegas; w++ ) Omegas[w] = 0.25 * w;
+
+    Model SDModel ( Masses, Dampers, Springs );
+
+    auto Serial   = SDModel.FrequencySweep ( Force, Omegas, 1 );
+    auto Parallel = SDModel.FrequencySweep ( Force, Omegas, 4 );
+
+    ASSERT_EQ ( Serial.size(), n * nOmegas );
+
+    // disjoint columns, identical for any number of threads 
+    EXPECT_EQ ( Serial, Parallel );
+
+    Vector Zeros ( n, 0.0 );
+
+    for ( auto w = 0; w < nOmegas; w++ ) {
+
+        auto expected = SDModel.ComputeResponse ( 
+            Force, Omegas[w], Zeros.cbegin(), Zeros.cend() 
+        );
+
+        for ( auto j = 0; j < n; j++ ) {
+
+            EXPECT_EQ ( Serial[j+w*n], expected[j] );
+
+        }
+
+    }
+
+}
+
+
+TEST ( MassSpringDamper, FrequencySweepAtResonance ) {
+
+    typedef std::complex<double> Complex;
+
+    typedef Analytical::MassSpringDamper<size_t,double,Complex> Model;
+
+    // undamped single dof, k - omega^2 m vanishes at omega = 2 
+    Model SDModel ( { 1.0 }, { 0.0 }, { 4.0 } );
+
+    std::vector<Complex> Force { 1.0 };
+
+    EXPECT_THROW ( 
+        SDModel.FrequencySweep ( Force, { 1.0, 2.0, 3.0 } ), 
+        std::runtime_error 
+    );
+
+    EXPECT_THROW ( 
+        SDModel.FrequencySweep ( { 1.0, 1.0 }, { 1.0 } ), 
+        std::runtime_error 
+    );
+
+}
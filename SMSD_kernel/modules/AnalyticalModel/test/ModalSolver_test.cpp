@@ -0,0 +1,202 @@
+/**
+  * @file ModalSolver_test.cpp 
+  *
+  * @brief 
+  * Tests of the modal superposition solver of Mass-Spring-Damper model 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#include "AnalyticalModel.hpp" 
+#include <gtest/gtest.h> 
+
+typedef std::complex<double> Complex;
+
+typedef Analytical::MassSpringDamper<size_t,double,Complex> Model;
+typedef Analytical::ModalSolver<size_t,double,Complex> Modal;
+
+/**
+  * @brief 
+  * Chain of n dofs, dampers are proportional to springs when Classical 
+  */
+Model MockModel ( const size_t n, const bool Classical ) {
+
+    std::vector<double> Masses ( n ), Dampers ( n ), Springs ( n );
+
+    for ( auto i = 0; i < n; i++ ) {
+
+        Masses [i] = 1.0 + 0.2 * std::sin ( i );
+        Springs[i] = 400.0 + 30.0 * i;
+
+        Dampers[i] = Classical ? 0.002 * Springs[i] : 0.5 + 0.4 * std::cos ( i );
+
+    }
+
+    return Model ( Masses, Dampers, Springs );
+
+}
+
+
+TEST ( ModalSolver, FrequenciesMatchGeneralizedEigenproblem ) {
+
+    size_t n = 12;
+
+    auto SDModel = MockModel ( n, true );
+
+    Modal Solver ( SDModel, 5 );
+
+    ASSERT_EQ ( Solver.nModes(), 5 );
+
+    typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic> MatrixXR;
+
+    std::vector<double> Masses ( n );
+
+    for ( auto i = 0; i < n; i++ ) Masses[i] = 1.0 + 0.2 * std::sin ( i );
+
+    std::vector<double> Springs ( n );
+
+    for ( auto i = 0; i < n; i++ ) Springs[i] = 400.0 + 30.0 * i;
+
+    auto KM = SDModel.StiffnessMatrix ( Springs );
+    auto MM = SDModel.MassMatrix ( Masses );
+
+    Eigen::Map<MatrixXR> k ( KM.data(), n, n ), m ( MM.data(), n, n );
+
+    Eigen::GeneralizedSelfAdjointEigenSolver<MatrixXR> Reference ( k, m );
+
+    auto Frequencies = Solver.Frequencies();
+
+    for ( auto r = 0; r < 5; r++ ) {
+
+        EXPECT_NEAR (
+            Frequencies[r], std::sqrt ( Reference.eigenvalues()[r] ),
+            1e-10 * Frequencies[r]
+        );
+
+    }
+
+    // modes are mass-normalized 
+    Eigen::Map<const MatrixXR> modes ( Solver.Modes().data(), n, 5 );
+
+    MatrixXR Identity = modes.transpose() * m * modes;
+
+    EXPECT_TRUE ( Identity.isIdentity ( 1e-12 ) );
+
+}
+
+
+TEST ( ModalSolver, AllModesMatchDirectSweep ) {
+
+    size_t n = 15;
+
+    std::vector<double> Omegas;
+
+    for ( auto w = 0; w < 200; w++ ) Omegas.push_back ( 0.3 * w );
+
+    std::vector<Complex> Force ( n, Complex ( 0.0, 0.0 ) );
+
+    Force[n-1] = Complex ( 1.0, 0.5 );
+
+    for ( bool Classical : { true, false } ) {
+
+        auto SDModel = MockModel ( n, Classical );
+
+        auto Direct = SDModel.FrequencySweep ( Force, Omegas );
+
+        // proportional damping is exact only for classical damping 
+        auto Damping = Classical ?
+            Analytical::ModalDamping::Proportional :
+            Analytical::ModalDamping::NonProportional;
+
+        Modal Solver ( SDModel, 0, Damping );
+
+        auto Approx = Solver.FrequencySweep ( Force, Omegas, 2 );
+
+        ASSERT_EQ ( Approx.size(), Direct.size() );
+
+        for ( auto i = 0; i < Direct.size(); i++ ) {
+
+            EXPECT_NEAR (
+                std::abs ( Approx[i] - Direct[i] ), 0.0,
+                1e-9 * std::abs ( Direct[i] ) + 1e-15
+            );
+
+        }
+
+        auto Single = Solver.ComputeResponse ( Force, Omegas[17] );
+
+        for ( auto j = 0; j < n; j++ ) {
+
+            EXPECT_NEAR ( std::abs ( Single[j] - Approx[j+17*n] ), 0.0, 1e-15 );
+
+        }
+
+    }
+
+}
+
+
+TEST ( ModalSolver, TruncationConvergesBelowResonances ) {
+
+    size_t n = 30;
+
+    auto SDModel = MockModel ( n, true );
+
+    std::vector<Complex> Force ( n, 1.0 );
+
+    Modal Full ( SDModel );
+
+    // below the first natural frequency 
+    double omega = 0.5 * Full.Frequencies()[0];
+
+    auto Direct = SDModel.FrequencySweep ( Force, { omega } );
+
+    double Previous = 1e300;
+
+    for ( size_t nModes : { 2, 5, 10, 30 } ) {
+
+        Modal Solver ( SDModel, nModes );
+
+        auto Approx = Solver.ComputeResponse ( Force, omega );
+
+        double Error = 0.0, Norm = 0.0;
+
+        for ( auto j = 0; j < n; j++ ) {
+
+            Error += std::norm ( Approx[j] - Direct[j] );
+            Norm  += std::norm ( Direct[j] );
+
+        }
+
+        Error = std::sqrt ( Error / Norm );
+
+        EXPECT_LE ( Error, Previous );
+
+        Previous = Error;
+
+    }
+
+    EXPECT_LT ( Previous, 1e-10 );
+
+}
+
+
+TEST ( ModalSolver, InvalidInputs ) {
+
+    auto SDModel = MockModel ( 4, true );
+
+    EXPECT_THROW ( Modal ( SDModel, 5 ), std::runtime_error );
+
+    Modal Solver ( SDModel );
+
+    std::vector<Complex> Short ( 3 );
+
+    EXPECT_THROW ( Solver.ComputeResponse ( Short, 1.0 ), std::runtime_error );
+
+    Model Massless ( { 1.0, 0.0 }, { 0.1, 0.1 }, { 1.0, 1.0 } );
+
+    EXPECT_THROW ( Modal Bad ( Massless ), std::runtime_error );
+
+}
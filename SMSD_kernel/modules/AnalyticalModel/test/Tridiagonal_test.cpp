@@ -0,0 +1,207 @@
+/**
+  * @file Tridiagonal_test.cpp 
+  *
+  * @brief 
+  * Tests of the tridiagonal linear solver 
+  * 
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#include "AnalyticalModel.hpp" 
+#include <gtest/gtest.h> 
+
+TEST ( SolveTridiagonal, MatchDenseLU ) {
+
+    typedef double Float;
+    typedef std::complex<Float> Complex; 
+
+    typedef std::vector<Complex> VectorC;
+    typedef Eigen::Matrix<Complex, Eigen::Dynamic, Eigen::Dynamic> MatrixXC;
+    typedef Eigen::Vector<Complex, Eigen::Dynamic> VectorXC;
+
+    size_t n = 7;
+
+    VectorC Band ( 3 * n, 0.0 ), Rhs ( n );
+
+    MatrixXC A = MatrixXC::Zero ( n, n );
+    VectorXC b ( n );
+
+    for ( auto i = 0; i < n; i++ ) {
+
+        // small diagonal entries force row interchanges 
+        Complex diag ( 0.1 * std::cos ( i ), 0.05 * i );
+        Complex sub  ( 1.0 + 0.3 * i, -0.2 );
+        Complex sup  ( -0.7, 0.4 * std::sin ( i ) );
+
+        Band[n+i] = diag; A(i,i) = diag;
+
+        if ( i > 0     ) { Band[i]     = sub; A(i,i-1) = sub; }
+        if ( i + 1 < n ) { Band[2*n+i] = sup; A(i,i+1) = sup; }
+
+        Rhs[i] = Complex ( 1.0 + i, -0.5 * i ); b(i) = Rhs[i];
+
+    }
+
+    auto result = Analytical::SolveTridiagonal<size_t,Complex> ( Band, Rhs );
+
+    VectorXC expected = A.partialPivLu().solve ( b );
+
+    Float tol = 1e-12;
+
+    ASSERT_EQ ( result.size(), n );
+
+    for ( auto i = 0; i < n; i++ ) {
+
+        EXPECT_NEAR ( result[i].real(), expected(i).real(), tol );
+        EXPECT_NEAR ( result[i].imag(), expected(i).imag(), tol );
+
+    }
+
+}
+
+
+TEST ( SolveTridiagonal, SingleEquation ) {
+
+    typedef std::vector<double> Vector;
+
+    Vector Band { 0.0, 4.0, 0.0 };
+    Vector Rhs  { 2.0 };
+
+    auto result = Analytical::SolveTridiagonal<size_t,double> ( Band, Rhs );
+
+    ASSERT_EQ ( result.size(), 1 );
+    EXPECT_DOUBLE_EQ ( result[0], 0.5 );
+
+}
+
+
+TEST ( SolveTridiagonal, SingularMatrix ) {
+
+    typedef std::vector<double> Vector;
+
+    Vector Band { 0.0, 1.0, 1.0, 1.0, 1.0, 0.0 };
+    Vector Rhs  { 1.0, 1.0 };
+
+    EXPECT_THROW ( 
+        Analytical::SolveTridiagonal<size_t> ( Band, Rhs ), 
+        std::runtime_error 
+    );
+
+}
+
+
+TEST ( SolveTridiagonal, WrongBandSize ) {
+
+    typedef std::vector<double> Vector;
+
+    Vector Band { 0.0, 1.0, 1.0, 1.0 };
+    Vector Rhs  { 1.0, 1.0 };
+
+    EXPECT_THROW ( 
+        Analytical::SolveTridiagonal<size_t> ( Band, Rhs ), 
+        std::runtime_error 
+    );
+
+}
+
+
+TEST ( SolveTridiagonalBatch, MatchSolveTridiagonal ) {
+
+    typedef double Float;
+    typedef std::complex<Float> Complex; 
+
+    typedef std::vector<Float> Vector;
+    typedef std::vector<Complex> VectorC;
+
+    size_t n = 9, nBatch = 5;
+
+    Vector OffRe ( n * nBatch, 0.0 ), OffIm ( n * nBatch, 0.0 );
+    Vector DiagRe ( n * nBatch ), DiagIm ( n * nBatch );
+    Vector RhsRe  ( n * nBatch ), RhsIm  ( n * nBatch );
+
+    std::vector<VectorC> Expected;
+
+    for ( auto l = 0; l < nBatch; l++ ) {
+
+        VectorC Band ( 3 * n, 0.0 ), Rhs ( n );
+
+        for ( auto i = 0; i < n; i++ ) {
+
+            Complex diag ( 3.0 + std::cos ( i + l ), 0.2 * ( l + 1 ) );
+            Complex off  ( -1.0 - 0.1 * i, 0.05 * l );
+            Complex rhs  ( std::sin ( i * l ), 1.0 );
+
+            Band[n+i] = diag;
+            DiagRe[i*nBatch+l] = diag.real();
+            DiagIm[i*nBatch+l] = diag.imag();
+
+            if ( i + 1 < n ) {
+
+                Band[2*n+i] = off;
+                Band[i+1]   = off;
+                OffRe[i*nBatch+l] = off.real();
+                OffIm[i*nBatch+l] = off.imag();
+
+            }
+
+            Rhs[i] = rhs;
+            RhsRe[i*nBatch+l] = rhs.real();
+            RhsIm[i*nBatch+l] = rhs.imag();
+
+        }
+
+        Expected.push_back ( 
+            Analytical::SolveTridiagonal<size_t,Complex> ( Band, Rhs ) 
+        );
+
+    }
+
+    Analytical::SolveTridiagonalBatch<size_t,Float> ( 
+
+        n, nBatch, 
+        OffRe.data(),  OffIm.data(), 
+        DiagRe.data(), DiagIm.data(), 
+        RhsRe.data(),  RhsIm.data() 
+
+    );
+
+    Float tol = 1e-12;
+
+    for ( auto l = 0; l < nBatch; l++ ) {
+    for ( auto i = 0; i < n; i++ ) {
+
+        EXPECT_NEAR ( RhsRe[i*nBatch+l], Expected[l][i].real(), tol );
+        EXPECT_NEAR ( RhsIm[i*nBatch+l], Expected[l][i].imag(), tol );
+
+    }
+    }
+
+}
+
+
+TEST ( SolveTridiagonalBatch, ZeroPivot ) {
+
+    typedef std::vector<double> Vector;
+
+    Vector OffRe { 0.0 }, OffIm { 0.0 };
+    Vector DiagRe { 0.0 }, DiagIm { 0.0 };
+    Vector RhsRe  { 1.0 }, RhsIm  { 0.0 };
+
+    size_t n = 1, nBatch = 1;
+
+    EXPECT_THROW ( 
+
+        Analytical::SolveTridiagonalBatch ( 
+            n, nBatch, 
+            OffRe.data(),  OffIm.data(), 
+            DiagRe.data(), DiagIm.data(), 
+            RhsRe.data(),  RhsIm.data() 
+        ), 
+
+        std::runtime_error 
+
+    );
+
+}
@@ -18,5 +18,9 @@
 #include <Eigen/Dense> 
 #include <vector> 
 
+#ifdef _OPENMP 
+    #include <omp.h> 
+#endif 
+
 #endif // LIBRARIES_LOADER_AM 
 
@@ -65,6 +65,25 @@ namespace BasisFunctions {
     );
 
 
+    template < typename R, typename C >
+    /**
+      * @brief 
+      * Scratch buffers of Hermite evaluations. Buffers grow on first use 
+      * and keep their capacity, so repeated evaluations with the same 
+      * indices allocate nothing. 
+      *
+      * @tparam R a type of floating number e.g. double 
+      * @tparam C type of the arguments, R or complex 
+      */
+    struct HermiteScratch {
+
+        Vector<R> Sqrt; 
+        Vector<C> Block; 
+        Vector<C> Table; 
+
+    };
+
+
     template < typename Z, typename R, typename C >
     /**
       * @brief 
@@ -74,7 +93,8 @@ namespace BasisFunctions {
       *
       * @tparam Z a type of non-negative integer e.g. size_t
       * @tparam R a type of floating number e.g. double 
-      * @tparam C a type of floating complex number e.g. std::complex<float> 
+      * @tparam C a type of floating complex number e.g. std::complex<float>, 
+      *           or C = R for real arguments, which halves memory traffic 
       *
       * @param Indices vector of indices of Hermite polynomial 
       * @param Args    vector of arguments for Hermite polynomial 
@@ -87,6 +107,79 @@ namespace BasisFunctions {
     );
 
 
+    template < typename Z, typename R, typename C >
+    /**
+      * @brief 
+      * Variant of @ref HermitePolynomials writing into a caller buffer, 
+      * temporaries are kept in Scratch. 
+      *
+      * @param Indices  vector of indices of Hermite polynomial 
+      * @param Args     nSamples x SetSize arguments { Point1, Point2, ... } 
+      * @param nSamples number of points 
+      * @param SetSize  number of polynomials in a set 
+      * @param Result   output of nProducts x nSamples products 
+      * @param Scratch  reusable buffers 
+      */
+    void HermitePolynomials (
+
+        const Vector<Z>& Indices, 
+        const C* Args, 
+        const Z nSamples, 
+        const Z SetSize, 
+        C* Result, 
+        HermiteScratch<R,C>& Scratch 
+
+    );
+
+
+    template < typename Z, typename R >
+    /**
+      * @brief 
+      * Evaluate normalized multivariate Hermite polynomials for real 
+      * arguments stored as structure-of-arrays. Samples are processed in 
+      * blocks of @ref HermiteBatchLanes through the three-term recurrence 
+      * so that the compiler vectorizes across samples. Results are 
+      * identical to @ref HermitePolynomials with C = R. @n 
+      * Implemented in @ref _HermiteBatch_imp_hpp_ 
+      *
+      * @tparam Z a type of non-negative integer e.g. size_t
+      * @tparam R a type of floating number e.g. double 
+      *
+      * @param Indices vector of indices of Hermite polynomial 
+      * @param Args    arguments { Dim1 of all points, Dim2 of all points, ... } 
+      * @param nPoints number of points 
+      * @param SetSize number of polynomials in a set 
+      * @param Basis   output of nBasis x nPoints products, column-major 
+      */
+    void HermitePolynomialsBatch (
+
+        const Vector<Z>& Indices, 
+        const R* Args, 
+        const Z nPoints, 
+        const Z SetSize, 
+        R* Basis 
+
+    );
+
+
+    template < typename Z, typename R >
+    /**
+      * @brief 
+      * Variant of @ref HermitePolynomialsBatch keeping temporaries in 
+      * Scratch, see @ref HermiteScratch 
+      */
+    void HermitePolynomialsBatch (
+
+        const Vector<Z>& Indices, 
+        const R* Args, 
+        const Z nPoints, 
+        const Z SetSize, 
+        R* Basis, 
+        HermiteScratch<R,R>& Scratch 
+
+    );
+
+
     template < typename Z, typename R > 
     /**
       * @brief 
@@ -112,6 +205,63 @@ namespace BasisFunctions {
     );
 
 
+
+    template < typename Z, typename R > 
+    /**
+      * @class TripleProductTensor 
+      * 
+      * @brief 
+      * Non-zero expected values of products of three multivariate Hermite 
+      * polynomials E(H_k,H_i,H_j), enumerated once for a set of indices. 
+      * Entries are stored in coordinate format sorted by k, i, j, 
+      * entries of slice k are in [ Offsets()[k], Offsets()[k+1] ). @n 
+      * Implemented in @ref _TripleProductTensor_imp_hpp_ 
+      * 
+      * @tparam Z a type of non-negative integer e.g. size_t 
+      * @tparam R a type of floating number e.g. double 
+      */
+    class TripleProductTensor {
+
+        Vector<Z> Offsets_;
+        Vector<Z> Rows_;
+        Vector<Z> Cols_;
+        Vector<R> Values_;
+
+        Z nBasis_;
+
+        public: 
+
+        TripleProductTensor ();
+
+        /**
+          * @brief 
+          * Enumerate non-zero triples, zero entries are skipped using 
+          * parity and triangle inequality of each dimension. 
+          * 
+          * @param Indices vector of indices of Hermite polynomial 
+          * @param SetSize number of polynomials in a set 
+          * @param nSlices number of k to enumerate, k < nSlices 
+          */
+        TripleProductTensor ( 
+
+            const Vector<Z>& Indices, 
+            const Z SetSize, 
+            const Z nSlices 
+
+        );
+
+        Z nBasis   () const { return nBasis_; }
+        Z nSlices  () const { return Offsets_.size() - 1; }
+        Z NonZeros () const { return Values_.size(); }
+
+        const Vector<Z>& Offsets () const { return Offsets_; }
+        const Vector<Z>& Rows    () const { return Rows_; }
+        const Vector<Z>& Cols    () const { return Cols_; }
+        const Vector<R>& Values  () const { return Values_; }
+
+    };
+
+
 } // BasisFunctions 
 
 
@@ -127,9 +277,17 @@ namespace BasisFunctions {
     #include "HermitePolynomials_imp.hpp" 
 #endif 
 
+#ifndef HERMITE_BATCH_IMPLEMENTATIONS 
+    #include "HermiteBatch_imp.hpp" 
+#endif 
+
 #ifndef TRIPLE_HERMITE_IMPLEMENTATIONS 
     #include "TripleHermite_imp.hpp" 
 #endif 
 
+#ifndef TRIPLE_PRODUCT_TENSOR_IMPLEMENTATIONS 
+    #include "TripleProductTensor_imp.hpp" 
+#endif 
+
 #endif // BASIS_FUNCTIONS_DECLARATIONS 
 
@@ -0,0 +1,237 @@
+/**
+  * @file HermiteBatch_imp.hpp
+  *
+  * @brief 
+  * Implementation of blocked evaluation of multivariate Hermite polynomials 
+  * for many real samples. 
+  * 
+  * @anchor _HermiteBatch_imp_hpp_ 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#ifndef HERMITE_BATCH_IMPLEMENTATIONS 
+#define HERMITE_BATCH_IMPLEMENTATIONS 
+
+#ifndef BASIS_FUNCTIONS_DECLARATIONS 
+    #include "BasisFunctions.hpp" 
+#endif 
+
+
+namespace BasisFunctions {
+
+    /**
+      * @brief 
+      * Number of samples in a block. Eight doubles fill one AVX-512 register 
+      * or two AVX2 registers, the same loops serve narrower instruction sets. 
+      */
+    constexpr size_t HermiteBatchLanes = 8;
+
+
+    template < typename Z, typename R >
+    /**
+      * @private 
+      * 
+      * @brief 
+      * Evaluate normalized Hermite polynomials of index 0 to Order for a 
+      * block of samples. Same operations as @ref NormalizedHermiteTable 
+      * applied lane by lane. 
+      *
+      * @param Order largest index to evaluate 
+      * @param x     HermiteBatchLanes arguments 
+      * @param Sqrt  square roots of 0, 1, ..., Order 
+      * @param Table output of ( Order + 1 ) x HermiteBatchLanes values 
+      */
+    void NormalizedHermiteBlock ( 
+
+        const Z Order, 
+        const R* x, 
+        const R* Sqrt, 
+        R* Table 
+
+    );
+
+} // BasisFunctions : NormalizedHermiteBlock 
+
+
+namespace BasisFunctions {
+
+    template < typename Z, typename R >
+    void HermitePolynomialsBatch (
+
+        const Vector<Z>& Indices, 
+        const R* Args, 
+        const Z nPoints, 
+        const Z SetSize, 
+        R* Basis 
+
+    ) {
+
+        HermiteScratch<R,R> Scratch;
+
+        HermitePolynomialsBatch<Z,R> ( 
+            Indices, Args, nPoints, SetSize, Basis, Scratch 
+        );
+
+    }
+
+
+    template < typename Z, typename R >
+    void HermitePolynomialsBatch (
+
+        const Vector<Z>& Indices, 
+        const R* Args, 
+        const Z nPoints, 
+        const Z SetSize, 
+        R* Basis, 
+        HermiteScratch<R,R>& Scratch 
+
+    ) {
+
+        if ( SetSize <= 0 ) {
+
+            throw std::runtime_error (
+                "HermitePolynomialsBatch: dimension must be positive"
+            );
+
+        }
+
+        auto nProducts = Indices.size() / SetSize;
+
+        if ( Indices.size() - SetSize * nProducts != 0 ) {
+
+            throw std::runtime_error (
+                "HermitePolynomialsBatch: num of indices not multiple of dimension"
+            );
+
+        }
+
+        constexpr Z Lanes = HermiteBatchLanes;
+
+        Z Order = Indices.empty() ? 0 : 
+            *std::max_element ( Indices.begin(), Indices.end() );
+
+        auto& Sqrt = Scratch.Sqrt;
+
+        Sqrt.resize ( Order + 1 );
+
+        for ( auto n = 0; n <= Order; n++ ) {
+
+            Sqrt[n] = std::sqrt ( R(n) );
+
+        }
+
+        // Block of arguments, tail block is padded with zeros 
+        auto& X = Scratch.Block;
+
+        X.resize ( SetSize * Lanes );
+
+        // Univariate tables of a block, one ( Order + 1 ) x Lanes slab per dim 
+        auto& Table = Scratch.Table;
+
+        Table.resize ( ( Order + 1 ) * Lanes * SetSize );
+
+        R Product [Lanes];
+
+        for ( Z i0 = 0; i0 < nPoints; i0 += Lanes ) {
+
+            auto nLanes = std::min ( Lanes, nPoints - i0 );
+
+            for ( auto m = 0; m < SetSize; m++ ) {
+
+                std::fill ( 
+                    X.begin() + m * Lanes, X.begin() + ( m + 1 ) * Lanes, R(0) 
+                );
+
+                std::copy ( 
+
+                    Args + m * nPoints + i0, 
+                    Args + m * nPoints + i0 + nLanes, 
+                    X.begin() + m * Lanes 
+
+                );
+
+                NormalizedHermiteBlock<Z,R> ( 
+
+                    Order, 
+                    X.data() + m * Lanes, 
+                    Sqrt.data(), 
+                    Table.data() + m * ( Order + 1 ) * Lanes 
+
+                );
+
+            }
+
+            for ( auto j = 0; j < nProducts; j++ ) {
+
+                const R* Row = 
+                    Table.data() + Indices[j*SetSize] * Lanes;
+
+                for ( auto l = 0; l < Lanes; l++ ) Product[l] = Row[l];
+
+                for ( auto m = 1; m < SetSize; m++ ) {
+
+                    Row = Table.data() + 
+                        ( m * ( Order + 1 ) + Indices[j*SetSize+m] ) * Lanes;
+
+                    for ( auto l = 0; l < Lanes; l++ ) Product[l] *= Row[l];
+
+                }
+
+                for ( auto l = 0; l < nLanes; l++ ) {
+
+                    Basis[(i0+l)*nProducts+j] = Product[l];
+
+                }
+
+            }
+
+        }
+
+    }
+
+} // BasisFunctions : HermitePolynomialsBatch 
+
+
+namespace BasisFunctions {
+
+    template < typename Z, typename R >
+    void NormalizedHermiteBlock ( 
+
+        const Z Order, 
+        const R* x, 
+        const R* Sqrt, 
+        R* Table 
+
+    ) {
+
+        constexpr Z Lanes = HermiteBatchLanes;
+
+        for ( auto l = 0; l < Lanes; l++ ) Table[l] = 1.0;
+
+        if ( Order == 0 ) return;
+
+        for ( auto l = 0; l < Lanes; l++ ) Table[Lanes+l] = x[l];
+
+        for ( Z n = 1; n < Order; n++ ) {
+
+            const R* Prev = Table + ( n - 1 ) * Lanes;
+            const R* Curr = Table + n * Lanes;
+            R* Next = Table + ( n + 1 ) * Lanes;
+
+            for ( auto l = 0; l < Lanes; l++ ) {
+
+                Next[l] = ( x[l] * Curr[l] - Sqrt[n] * Prev[l] ) / Sqrt[n+1];
+
+            }
+
+        }
+
+    }
+
+} // BasisFunctions : NormalizedHermiteBlock 
+
+
+#endif // HERMITE_BATCH_IMPLEMENTATIONS 
@@ -71,6 +71,34 @@ namespace BasisFunctions {
       */
     C HermitePolynomial ( const Z index, const C x );
 
+
+    template < typename Z, typename R, typename C >
+    /**
+      * @private 
+      * 
+      * @brief 
+      * Evaluate normalized probabilist Hermite polynomials of index 0 to 
+      * Order at given position using the three-term recurrence 
+      * H_{n+1} = ( x H_n - sqrt(n) H_{n-1} ) / sqrt(n+1), O(Order). 
+      *
+      * @tparam Z a type of non-negative integer e.g. size_t
+      * @tparam R a type of floating number e.g. double 
+      * @tparam C a type of floating complex number e.g. std::complex<float> 
+      * 
+      * @param Order largest index to evaluate 
+      * @param x     argument to evaluate the polynomials 
+      * @param Sqrt  square roots of 0, 1, ..., Order 
+      * @param Table output of Order + 1 values H_n(x) / sqrt(n!) 
+      */
+    void NormalizedHermiteTable ( 
+
+        const Z Order, 
+        const C x, 
+        const Vector<R>& Sqrt, 
+        C* Table 
+
+    );
+
 } // BasisFunctions : HermitePolynomial 
 
 
@@ -108,41 +136,98 @@ namespace BasisFunctions {
 
         }
 
-        Vector<C> result;
-        result.reserve ( nProducts * nSamples );
+        Vector<C> result ( nProducts * nSamples );
 
-        for ( auto i = 0; i < nSamples ; i++ ) {
-        for ( auto j = 0; j < nProducts; j++ ) {
+        HermiteScratch<R,C> Scratch;
 
-            C unity = 1.0;
+        HermitePolynomials<Z,R,C> ( 
+            Indices, Args.data(), nSamples, SetSize, result.data(), Scratch 
+        );
 
-            result.push_back ( 
-                std::transform_reduce (
-                
-                    Indices.begin() + j * SetSize,
-                    Indices.begin() + j * SetSize + SetSize,
-                       Args.begin() + i * SetSize,
+        return result;
 
-                    unity,
+    }
 
-                    // resulting polynomials are multiplied
-                    []( const auto N, const auto P ) { return N * P ; },
 
-                    // polynomials with given index and variable
-                    []( const auto idx, const auto x ) {
+    template < typename Z, typename R, typename C >
+    void HermitePolynomials ( 
 
-                        return HermitePolynomial<Z,C> ( idx, x ) / 
+        const Vector<Z>& Indices, 
+        const C* Args, 
+        const Z nSamples, 
+        const Z SetSize, 
+        C* Result, 
+        HermiteScratch<R,C>& Scratch 
 
-                               std::sqrt<R> ( Factorial<Z> ( idx ) );
+    ) {
 
-                    }
-                ) 
+        if ( SetSize <= 0 ) {
+
+            throw std::runtime_error (
+                "HermitePolynomials: dimension must be positive"
             );
 
         }
+
+        auto nProducts = Indices.size() / SetSize;
+
+        if ( Indices.size() - SetSize * nProducts != 0 ) {
+
+            throw std::runtime_error (
+                "HermitePolynomials: num of indices not multiple of dimension"
+            );
+
         }
 
-        return result;
+        Z Order = Indices.empty() ? 0 : 
+            *std::max_element ( Indices.begin(), Indices.end() );
+
+        auto& Sqrt = Scratch.Sqrt;
+
+        Sqrt.resize ( Order + 1 );
+
+        for ( auto n = 0; n <= Order; n++ ) {
+
+            Sqrt[n] = std::sqrt ( R(n) );
+
+        }
+
+        // Table of all univariate polynomials of a sample, one row per dim 
+        auto& Table = Scratch.Table;
+
+        Table.resize ( ( Order + 1 ) * SetSize );
+
+        for ( auto i = 0; i < nSamples; i++ ) {
+
+            for ( auto m = 0; m < SetSize; m++ ) {
+
+                NormalizedHermiteTable<Z,R,C> ( 
+
+                    Order, 
+                    Args[i*SetSize+m], 
+                    Sqrt, 
+                    Table.data() + m * ( Order + 1 ) 
+
+                );
+
+            }
+
+            // each multivariate polynomial is a product of table lookups 
+            for ( auto j = 0; j < nProducts; j++ ) {
+
+                C product = Table[Indices[j*SetSize]];
+
+                for ( auto m = 1; m < SetSize; m++ ) {
+
+                    product *= Table[m*(Order+1)+Indices[j*SetSize+m]];
+
+                }
+
+                Result[i*nProducts+j] = product;
+
+            }
+
+        }
 
     }
 
@@ -169,6 +254,35 @@ namespace BasisFunctions {
 } // BasisFunctions : HermitePolynomial 
 
 
+namespace BasisFunctions {
+
+    template < typename Z, typename R, typename C >
+    void NormalizedHermiteTable ( 
+
+        const Z Order, 
+        const C x, 
+        const Vector<R>& Sqrt, 
+        C* Table 
+
+    ) {
+
+        Table[0] = 1.0;
+
+        if ( Order == 0 ) return;
+
+        Table[1] = x;
+
+        for ( auto n = 1; n < Order; n++ ) {
+
+            Table[n+1] = ( x * Table[n] - Sqrt[n] * Table[n-1] ) / Sqrt[n+1];
+
+        }
+
+    }
+
+} // BasisFunctions : NormalizedHermiteTable 
+
+
 namespace BasisFunctions {
 
     template < typename Z >
@@ -0,0 +1,145 @@
+/**
+  * @file TripleProductTensor_imp.hpp
+  *
+  * @brief 
+  * Implementations of sparse tensor of exp value of Hermite triples 
+  * 
+  * @anchor _TripleProductTensor_imp_hpp_ 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#ifndef TRIPLE_PRODUCT_TENSOR_IMPLEMENTATIONS 
+#define TRIPLE_PRODUCT_TENSOR_IMPLEMENTATIONS 
+
+#ifndef BASIS_FUNCTIONS_DECLARATIONS 
+    #include "BasisFunctions.hpp" 
+#endif 
+
+
+namespace BasisFunctions {
+
+    template < typename Z, typename R >
+    TripleProductTensor<Z,R>::TripleProductTensor () : 
+
+        Offsets_ ( 1, 0 ), nBasis_ ( 0 ) {}
+
+
+    template < typename Z, typename R >
+    TripleProductTensor<Z,R>::TripleProductTensor ( 
+
+        const Vector<Z>& Indices, 
+        const Z SetSize, 
+        const Z nSlices 
+
+    ) {
+
+        if ( SetSize <= 0 ) {
+
+            throw std::runtime_error (
+                "TripleProductTensor: dimension must be positive"
+            );
+
+        }
+
+        nBasis_ = Indices.size() / SetSize;
+
+        if ( Indices.size() - SetSize * nBasis_ != 0 ) {
+
+            throw std::runtime_error (
+                "TripleProductTensor: num of indices not multiple of dimension"
+            );
+
+        }
+
+        if ( nSlices > nBasis_ ) {
+
+            throw std::runtime_error (
+                "TripleProductTensor: more slices than basis functions"
+            );
+
+        }
+
+
+        // ===================================================================
+        // Tabulate univariate E(H_a,H_b,H_c), the only factorials needed 
+        // ===================================================================
+
+        Z p = Indices.empty() ? 0 : 
+            *std::max_element ( Indices.begin(), Indices.end() );
+
+        auto n = p + 1;
+
+        Vector<R> Univariate ( n * n * n );
+
+        for ( Z a = 0; a < n; a++ ) {
+        for ( Z b = 0; b < n; b++ ) {
+        for ( Z c = 0; c < n; c++ ) {
+
+            Univariate[a+b*n+c*n*n] = EHermiteTriple<Z,R> ( a, b, c );
+
+        }
+        }
+        }
+
+
+        // ===================================================================
+        // Enumerate entries, reject (i,j,k) at the first dimension that 
+        // violates parity or triangle inequality 
+        // ===================================================================
+
+        Offsets_.assign ( 1, 0 );
+
+        for ( Z k = 0; k < nSlices; k++ ) {
+
+            auto K = Indices.begin() + k * SetSize;
+
+            for ( Z i = 0; i < nBasis_; i++ ) {
+
+                auto I = Indices.begin() + i * SetSize;
+
+                for ( Z j = 0; j < nBasis_; j++ ) {
+
+                    auto J = Indices.begin() + j * SetSize;
+
+                    auto NonZero = true;
+
+                    for ( Z m = 0; m < SetSize && NonZero; m++ ) {
+
+                        auto s = I[m] + J[m] + K[m];
+
+                        NonZero = ( s % 2 == 0 ) && 
+                                  ( 2 * std::max ( { I[m], J[m], K[m] } ) <= s );
+
+                    }
+
+                    if ( !NonZero ) continue;
+
+                    R value = 1.0;
+
+                    for ( Z m = 0; m < SetSize; m++ ) {
+
+                        value *= Univariate[I[m]+J[m]*n+K[m]*n*n];
+
+                    }
+
+                    Rows_.push_back   ( i );
+                    Cols_.push_back   ( j );
+                    Values_.push_back ( value );
+
+                }
+
+            }
+
+            Offsets_.push_back ( Values_.size() );
+
+        }
+
+    }
+
+} // BasisFunctions : TripleProductTensor 
+
+
+#endif // TRIPLE_PRODUCT_TENSOR_IMPLEMENTATIONS 
@@ -0,0 +1,137 @@
+/**
+  * @file HermiteBatch_test.cpp
+  *
+  * @brief 
+  * Tests of blocked evaluation of multivariate Hermite polynomials 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#include "BasisFunctions.hpp" 
+#include <gtest/gtest.h> 
+
+TEST ( HermitePolynomialsBatch, MatchHermitePolynomials ) {
+
+    size_t dim = 3;
+
+    auto indices = BasisFunctions::MultiIndex<size_t> ( dim, 5 );
+
+    size_t nBasis  = indices.size() / dim;
+
+    // not a multiple of the block width to cover the padded tail 
+    size_t nPoints = 3 * BasisFunctions::HermiteBatchLanes + 5;
+
+    std::vector<double> X ( nPoints * dim );
+
+    for ( auto i = 0; i < X.size(); i++ ) {
+
+        X[i] = std::sin ( 0.7 * i ) * 2.5;
+
+    }
+
+    std::vector<double> SoA ( nPoints * dim );
+
+    for ( auto i = 0; i < nPoints; i++ ) {
+    for ( auto m = 0; m < dim; m++ ) {
+
+        SoA[m*nPoints+i] = X[i*dim+m];
+
+    }
+    }
+
+    std::vector<double> result ( nBasis * nPoints );
+
+    BasisFunctions::HermitePolynomialsBatch<size_t,double> ( 
+        indices, SoA.data(), nPoints, dim, result.data() 
+    );
+
+    auto expected = 
+        BasisFunctions::HermitePolynomials<size_t,double,double> ( 
+            indices, X, dim 
+        );
+
+    ASSERT_EQ ( result.size(), expected.size() );
+
+    for ( auto i = 0; i < result.size(); i++ ) {
+
+        EXPECT_EQ ( result[i], expected[i] );
+
+    }
+
+}
+
+
+TEST ( HermitePolynomialsBatch, ZeroOrder ) {
+
+    size_t dim = 2;
+
+    std::vector<size_t> indices { 0, 0 };
+
+    std::vector<double> SoA { 0.5, -1.0, 2.0, 0.1, 0.2, 0.3 };
+
+    std::vector<double> result ( 3 );
+
+    BasisFunctions::HermitePolynomialsBatch<size_t,double> ( 
+        indices, SoA.data(), 3, dim, result.data() 
+    );
+
+    for ( auto value : result ) EXPECT_DOUBLE_EQ ( value, 1.0 );
+
+}
+
+
+TEST ( HermitePolynomialsBatch, InvalidIndices ) {
+
+    std::vector<size_t> indices { 0, 1, 2 };
+
+    std::vector<double> SoA ( 4 ), result ( 4 );
+
+    size_t nPoints = 2, dim = 2;
+
+    EXPECT_THROW ( 
+
+        BasisFunctions::HermitePolynomialsBatch ( 
+            indices, SoA.data(), nPoints, dim, result.data() 
+        ), 
+
+        std::runtime_error 
+
+    );
+
+}
+
+
+TEST ( HermitePolynomialsBatch, ReusedScratchMatchFreshBuffers ) {
+
+    size_t dim = 2;
+
+    auto indices = BasisFunctions::MultiIndex<size_t> ( dim, 4 );
+
+    size_t nBasis = indices.size() / dim;
+
+    BasisFunctions::HermiteScratch<double,double> Scratch;
+
+    // scratch of a larger and a smaller call is reused by the next one 
+    for ( size_t nPoints : { 17, 3, 11 } ) {
+
+        std::vector<double> SoA ( nPoints * dim );
+
+        for ( auto i = 0; i < SoA.size(); i++ ) SoA[i] = std::cos ( 1.3 * i );
+
+        std::vector<double> result ( nBasis * nPoints ), expected ( nBasis * nPoints );
+
+        BasisFunctions::HermitePolynomialsBatch<size_t,double> ( 
+            indices, SoA.data(), nPoints, dim, result.data(), Scratch 
+        );
+
+        BasisFunctions::HermitePolynomialsBatch<size_t,double> ( 
+            indices, SoA.data(), nPoints, dim, expected.data() 
+        );
+
+        EXPECT_EQ ( result, expected );
+
+    }
+
+}
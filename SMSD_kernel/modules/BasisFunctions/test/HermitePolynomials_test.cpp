@@ -586,3 +586,131 @@ TEST ( HermitePolynomials, ZeroDimension ) {
 
 }
 
+
+TEST ( NormalizedHermiteTable, MatchRecursiveDefinition ) {
+
+    typedef std::complex<double> Complex;
+
+    size_t order = 12;
+
+    std::vector<double> Sqrt ( order + 1 );
+
+    for ( auto n = 0; n <= order; n++ ) {
+        Sqrt[n] = std::sqrt ( double(n) );
+    }
+
+    Complex x ( 1.3, -0.4 );
+
+    std::vector<Complex> table ( order + 1 );
+
+    BasisFunctions::NormalizedHermiteTable<size_t,double,Complex> (
+        order, x, Sqrt, table.data() 
+    );
+
+    for ( size_t n = 0; n <= order; n++ ) {
+
+        auto expected = BasisFunctions::HermitePolynomial ( n, x ) / 
+            std::sqrt ( double ( BasisFunctions::Factorial<size_t> ( n ) ) );
+
+        EXPECT_NEAR ( table[n].real(), expected.real(), 1e-10 );
+        EXPECT_NEAR ( table[n].imag(), expected.imag(), 1e-10 );
+
+    }
+
+}
+
+TEST ( HermitePolynomials, HighOrderManyDimensions ) {
+
+    typedef std::complex<double> Complex;
+
+    size_t dim = 6;
+
+    std::vector<size_t> indices { 
+
+        0, 0, 0, 0, 0, 0, 
+        10, 0, 0, 0, 0, 0, 
+        1, 2, 3, 1, 2, 1, 
+        0, 0, 4, 0, 0, 6 
+
+    };
+
+    std::vector<Complex> X { 
+
+        0.3, -1.2, 0.8, 2.1, -0.5, 1.7, 
+        -2.4, 0.1, 1.1, -0.9, 0.6, -1.3 
+
+    };
+
+    auto result =
+        BasisFunctions::HermitePolynomials<
+
+            size_t, double, Complex
+
+        > ( indices, X, dim );
+
+    size_t nBasis = indices.size() / dim;
+
+    ASSERT_EQ ( result.size(), nBasis * 2 );
+
+    for ( auto i = 0; i < 2; i++ ) {
+    for ( auto j = 0; j < nBasis; j++ ) {
+
+        Complex expected = 1.0;
+
+        for ( auto m = 0; m < dim; m++ ) {
+
+            auto idx = indices[j*dim+m];
+
+            expected *= BasisFunctions::HermitePolynomial ( idx, X[i*dim+m] ) /
+                std::sqrt ( double ( BasisFunctions::Factorial<size_t> (idx) ) );
+
+        }
+
+        EXPECT_NEAR ( result[i*nBasis+j].real(), expected.real(), 1e-10 );
+        EXPECT_NEAR ( result[i*nBasis+j].imag(), expected.imag(), 1e-10 );
+
+    }
+    }
+
+}
+
+
+TEST ( HermitePolynomials, RealArgsMatchComplexArgs ) {
+
+    typedef std::complex<double> Complex;
+
+    size_t dim = 3;
+
+    std::vector<size_t> indices { 
+
+        0, 0, 0, 
+        1, 0, 2, 
+        3, 1, 0, 
+        0, 5, 4 
+
+    };
+
+    std::vector<double> X { 0.3, -1.2, 0.8, 2.1, -0.5, 1.7 };
+
+    std::vector<Complex> Y ( X.begin(), X.end() );
+
+    auto real = 
+        BasisFunctions::HermitePolynomials<size_t, double, double> ( 
+            indices, X, dim 
+        );
+
+    auto complex = 
+        BasisFunctions::HermitePolynomials<size_t, double, Complex> ( 
+            indices, Y, dim 
+        );
+
+    ASSERT_EQ ( real.size(), complex.size() );
+
+    for ( auto i = 0; i < real.size(); i++ ) {
+
+        EXPECT_EQ ( real[i], complex[i].real() );
+        EXPECT_DOUBLE_EQ ( 0.0, complex[i].imag() );
+
+    }
+
+}
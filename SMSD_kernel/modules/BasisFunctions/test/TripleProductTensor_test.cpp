@@ -0,0 +1,173 @@
+/**
+  * @file TripleProductTensor_test.cpp
+  *
+  * @brief 
+  * Tests of sparse tensor of exp value of Hermite triples 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#include "BasisFunctions.hpp" 
+#include <gtest/gtest.h> 
+
+TEST ( TripleProductTensor, MatchExpHermiteTriples ) {
+
+    typedef double Float;
+
+    size_t dim = 3;
+
+    auto indices = BasisFunctions::MultiIndex<size_t> ( dim, 3 );
+
+    size_t nBasis = indices.size() / dim;
+
+    BasisFunctions::TripleProductTensor<size_t,Float> tensor ( 
+        indices, dim, nBasis 
+    );
+
+    ASSERT_EQ ( tensor.nBasis(), nBasis );
+    ASSERT_EQ ( tensor.nSlices(), nBasis );
+
+    const auto& offsets = tensor.Offsets();
+
+    Float tol = 1e-12;
+
+    for ( size_t k = 0; k < nBasis; k++ ) {
+
+        auto expected = BasisFunctions::ExpHermiteTriples<size_t,Float> (
+            indices, dim, k 
+        );
+
+        std::vector<Float> result ( nBasis * nBasis, 0.0 );
+
+        for ( auto e = offsets[k]; e < offsets[k+1]; e++ ) {
+
+            EXPECT_NE ( tensor.Values()[e], 0.0 );
+
+            result[ tensor.Rows()[e] * nBasis + tensor.Cols()[e] ] = 
+                tensor.Values()[e];
+
+        }
+
+        for ( auto i = 0; i < result.size(); i++ ) {
+
+            EXPECT_NEAR ( result[i], expected[i], tol );
+
+        }
+
+    }
+
+}
+
+TEST ( TripleProductTensor, SkipZeroEntries ) {
+
+    typedef double Float;
+
+    // 1D, H_0..H_2 : non-zero triples only when sum is even and 
+    // satisfies triangle inequality 
+    std::vector<size_t> indices { 0, 1, 2 };
+
+    BasisFunctions::TripleProductTensor<size_t,Float> tensor ( 
+        indices, 1, 3 
+    );
+
+    std::vector<size_t> expectedOffsets { 0, 3, 7, 11 };
+
+    ASSERT_EQ ( tensor.Offsets().size(), expectedOffsets.size() );
+
+    for ( auto i = 0; i < expectedOffsets.size(); i++ ) {
+
+        EXPECT_EQ ( tensor.Offsets()[i], expectedOffsets[i] );
+
+    }
+
+    EXPECT_EQ ( tensor.NonZeros(), 11 );
+
+    // E(H_2,H_2,H_2) = 2! 2! 2! ^ 0.5 / ( 1! 1! 1! ) = sqrt(8) 
+    EXPECT_NEAR ( tensor.Values().back(), std::sqrt(8.0), 1e-12 );
+
+}
+
+TEST ( TripleProductTensor, PartialSlices ) {
+
+    typedef double Float;
+
+    size_t dim = 2;
+
+    auto indices = BasisFunctions::MultiIndex<size_t> ( dim, 2 );
+
+    BasisFunctions::TripleProductTensor<size_t,Float> tensor ( 
+        indices, dim, 1 
+    );
+
+    // k = 0 is the constant polynomial, slice is the identity 
+    ASSERT_EQ ( tensor.nSlices(), 1 );
+    ASSERT_EQ ( tensor.NonZeros(), indices.size() / dim );
+
+    for ( auto e = 0; e < tensor.NonZeros(); e++ ) {
+
+        EXPECT_EQ ( tensor.Rows()[e], tensor.Cols()[e] );
+        EXPECT_NEAR ( tensor.Values()[e], 1.0, 1e-12 );
+
+    }
+
+}
+
+TEST ( TripleProductTensor, WrongIndicesSize ) {
+
+    typedef BasisFunctions::TripleProductTensor<size_t,double> Tensor;
+
+    std::vector<size_t> indices { 0, 0, 1 };
+
+    EXPECT_THROW ({
+
+        try {
+
+            Tensor tensor (
+                indices, 2, 1 
+            );
+
+        } catch ( const std::exception& e ) {
+
+            EXPECT_STREQ (
+                "TripleProductTensor: num of indices not multiple of dimension",
+                e.what()
+            );
+
+            throw;
+
+        }
+
+    }, std::runtime_error );
+
+}
+
+TEST ( TripleProductTensor, TooManySlices ) {
+
+    typedef BasisFunctions::TripleProductTensor<size_t,double> Tensor;
+
+    std::vector<size_t> indices { 0, 0, 1, 0 };
+
+    EXPECT_THROW ({
+
+        try {
+
+            Tensor tensor (
+                indices, 2, 3 
+            );
+
+        } catch ( const std::exception& e ) {
+
+            EXPECT_STREQ (
+                "TripleProductTensor: more slices than basis functions",
+                e.what()
+            );
+
+            throw;
+
+        }
+
+    }, std::runtime_error );
+
+}
@@ -31,6 +31,70 @@ namespace MonteCarlo {
     using MatrixXT = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>;
 
 
+    /**
+      * @class Philox 
+      * 
+      * @brief 
+      * Counter-based Philox4x32-10 generator (Salmon et al., SC'11). 
+      * Block n of a stream is a pure function of ( Seed, Stream, n ), so a 
+      * thread or chunk jumps straight to its subsequence with Seek or 
+      * evaluates blocks directly with Block. Satisfies the standard 
+      * UniformRandomBitGenerator requirements. @n 
+      * Implemented in @ref _Philox_imp_hpp_ 
+      * 
+      * @anchor _Philox_ 
+      */
+    class Philox {
+
+        std::uint32_t Key_[2];
+        std::uint64_t Stream_;
+        std::uint64_t Counter_;
+
+        std::array<std::uint32_t,4> Buffer_;
+        unsigned Index_;
+
+        public: 
+
+        typedef std::uint32_t result_type;
+
+        /**
+          * @param Seed   key of the generator 
+          * @param Stream independent subsequence, e.g. thread or dimension 
+          */
+        Philox ( const std::uint64_t Seed, const std::uint64_t Stream = 0 );
+
+        static constexpr result_type min () { return 0; }
+        static constexpr result_type max () { return 0xFFFFFFFF; }
+
+        /**
+          * @brief 
+          * Next 32-bit word, four words per block 
+          */
+        result_type operator() ();
+
+        /**
+          * @brief 
+          * Jump to the first word of given block 
+          */
+        void Seek ( const std::uint64_t Block );
+
+        /**
+          * @brief 
+          * Four 32-bit words of given block of this stream 
+          */
+        std::array<std::uint32_t,4> Block ( const std::uint64_t Counter ) const;
+
+        template < typename R >
+        /**
+          * @brief 
+          * Map two 32-bit words to a uniform number in (0,1) with 52 
+          * random bits, zero and one are never returned. 
+          */
+        static R Uniform ( const std::uint32_t Hi, const std::uint32_t Lo );
+
+    };
+
+
     template < typename Z, typename R >
     /**
       * @brief
@@ -50,6 +114,160 @@ namespace MonteCarlo {
     Vector<R> LHS ( const Z nPoints, const Z Dim );
 
 
+    template < typename Z, typename R >
+    /**
+      * @brief 
+      * Reproducible @ref _LHS_ driven by @ref _Philox_, dimension i uses 
+      * streams 2i ( permutation ) and 2i+1 ( position within interval ). 
+      * 
+      * @param Seed seed of the generator 
+      */
+    Vector<R> LHS ( const Z nPoints, const Z Dim, const std::uint64_t Seed );
+
+
+
+    template < typename Z, typename R >
+    /**
+      * @brief 
+      * Space-filling @ref _LHS_. Starting from the seeded design, pairs of 
+      * entries within a column are swapped by simulated annealing to 
+      * minimize the Morris-Mitchell criterion 
+      * phi_p = ( sum_{i<j} d_ij^-p )^(1/p) on the interval indices, which 
+      * approaches maximin for large p. A swap only changes distances of 
+      * the two rows involved, so each iteration costs O( nPoints * Dim ) 
+      * and no distance matrix is stored. @n 
+      * Implemented in @ref _LatinHypercubeSampling_imp_hpp_ 
+      * 
+      * @param nPoints     number of sampled points 
+      * @param Dim         dimension of each point 
+      * @param Seed        seed of the initial design and the annealing 
+      * @param nIterations number of proposed swaps, 0 means 100 * nPoints 
+      * @param p           exponent of the criterion 
+      * 
+      * @return vector { Point1, Point2, ... } 
+      */
+    Vector<R> OptimizedLHS ( 
+
+        const Z nPoints, 
+        const Z Dim, 
+        const std::uint64_t Seed, 
+        const Z nIterations = 0, 
+        const Z p = 50 
+
+    );
+
+
+    template < typename Z, typename R >
+    /**
+      * @brief 
+      * Sobol low-discrepancy points with Joe-Kuo direction numbers 
+      * ( new-joe-kuo-6.21201 ) in Gray-code order, 32-bit resolution. 
+      * Index 0 ( the origin ) is skipped so every value is in (0,1) and 
+      * can be passed to @ref ConvertLHStoStdNorm. Same point-major layout 
+      * as @ref _LHS_. @n 
+      * Implemented in @ref _QuasiMonteCarlo_imp_hpp_ 
+      * 
+      * @tparam Z a type of non-negative integer e.g. size_t 
+      * @tparam R a type of floating number e.g. double 
+      * 
+      * @param nPoints    number of sampled points 
+      * @param Dim        dimension of each point, at most 21 
+      * @param FirstPoint index of the first point of this chunk 
+      * 
+      * @return vector { Point1, Point2, ... } 
+      */
+    Vector<R> Sobol ( const Z nPoints, const Z Dim, const Z FirstPoint = 0 );
+
+
+    template < typename Z, typename R >
+    /**
+      * @brief 
+      * Owen-scrambled Sobol points. Each dimension gets a nested uniform 
+      * scramble by the hash of Burley ( JCGT 2020 ) keyed from 
+      * @ref _Philox_, index 0 is kept and values are cell centres in (0,1). 
+      * @n 
+      * Implemented in @ref _QuasiMonteCarlo_imp_hpp_ 
+      * 
+      * @param nPoints    number of sampled points 
+      * @param Dim        dimension of each point, at most 21 
+      * @param Seed       seed of the scrambling 
+      * @param FirstPoint index of the first point of this chunk 
+      * 
+      * @return vector { Point1, Point2, ... } 
+      */
+    Vector<R> ScrambledSobol ( 
+
+        const Z nPoints, 
+        const Z Dim, 
+        const std::uint64_t Seed, 
+        const Z FirstPoint = 0 
+
+    );
+
+
+    template < typename Z, typename R >
+    /**
+      * @brief 
+      * Halton points with a random permutation of digits per dimension and 
+      * digit position, dimension i uses the i-th prime as base. Values are 
+      * centres of the finest cells so they are in (0,1). @n 
+      * Implemented in @ref _QuasiMonteCarlo_imp_hpp_ 
+      * 
+      * @param nPoints    number of sampled points 
+      * @param Dim        dimension of each point 
+      * @param Seed       seed of the permutations 
+      * @param FirstPoint index of the first point of this chunk 
+      * 
+      * @return vector { Point1, Point2, ... } 
+      */
+    Vector<R> ScrambledHalton ( 
+
+        const Z nPoints, 
+        const Z Dim, 
+        const std::uint64_t Seed, 
+        const Z FirstPoint = 0 
+
+    );
+
+
+    template < typename Z, typename R >
+    /**
+      * @brief 
+      * Inverse of the standard normal CDF over a buffer, result may alias 
+      * the probabilities. Acklam's rational approximation ( relative error 
+      * below 1.15e-9 ) is refined by one Halley step on the smaller tail. 
+      * 
+      * Accuracy contract: for p in [1e-300, 1 - 1e-16] the result differs 
+      * from boost::math::quantile of the standard normal by at most 
+      * 1e-14 * max( 1, |x| ). p = 0 and p = 1 give -inf and +inf, p outside 
+      * [0,1] gives NaN. @n 
+      * Implemented in @ref _NormalDistribution_imp_hpp_ 
+      * 
+      * @tparam Z a type of non-negative integer e.g. size_t 
+      * @tparam R a type of floating number e.g. double 
+      * 
+      * @param P       probabilities 
+      * @param nPoints number of probabilities 
+      * @param X       quantiles 
+      */
+    void InverseNormalCDF ( const R* P, const Z nPoints, R* X );
+
+
+    template < typename Z, typename R >
+    /**
+      * @brief 
+      * Standard normal CDF over a buffer through erfc, result may alias the 
+      * arguments. No cancellation in the lower tail, relative error is 
+      * about ( 1 + x^2 ) machine epsilons from rounding x / sqrt(2). @n 
+      * Implemented in @ref _NormalDistribution_imp_hpp_ 
+      * 
+      * @param X       arguments 
+      * @param nPoints number of arguments 
+      * @param P       probabilities 
+      */
+    void NormalCDF ( const R* X, const Z nPoints, R* P );
+
+
     template < typename Z, typename R >
     /**
       * @brief 
@@ -66,9 +284,40 @@ namespace MonteCarlo {
 
 
     template < typename Z, typename R, typename C >
+    /**
+      * @brief 
+      * Sample standard normal random variables with a random seed. @n 
+      * Implemented in @ref _VariableGeneration_imp_hpp_ 
+      */
     Vector<C> RandomSampling ( const Z nPoints, const Z dim );
 
 
+    template < typename Z, typename R, typename C >
+    /**
+      * @brief 
+      * Sample standard normal random variables reproducibly. Variable e of 
+      * the whole sequence only depends on Seed and e, so chunks generated 
+      * with FirstPoint offsets, in any order or thread, are identical to 
+      * the corresponding part of a single call. @n 
+      * Implemented in @ref _VariableGeneration_imp_hpp_ 
+      * 
+      * @param nPoints    number of sampled points 
+      * @param dim        dimension of each point 
+      * @param Seed       seed of @ref _Philox_ 
+      * @param FirstPoint index of the first point of this chunk 
+      * 
+      * @return vector { Point1, Point2, ... } 
+      */
+    Vector<C> RandomSampling ( 
+
+        const Z nPoints, 
+        const Z dim, 
+        const std::uint64_t Seed, 
+        const Z FirstPoint = 0 
+
+    );
+
+
     template < typename R, typename C >
     /**
       * @brief 
@@ -156,14 +405,380 @@ namespace MonteCarlo {
 } // MonteCarlo : EvaluateFRF 
 
 
+namespace MonteCarlo {
+
+    template < typename Z, typename R, typename C >
+    /**
+      * @class StreamingStatistics 
+      * 
+      * @brief 
+      * Online statistics of complex responses fed chunk by chunk, memory 
+      * does not depend on number of samples. Keeps per-DOF mean, variance 
+      * E|u - mean|^2, min/max and histogram of |u|, and P^2 quantile 
+      * estimates of |u|. Partial accumulators, e.g. one per thread, are 
+      * combined with Merge. @n 
+      * Implemented in @ref _StreamingStatistics_imp_hpp_ 
+      * 
+      * @tparam Z a type of non-negative integer e.g. size_t 
+      * @tparam R a type of floating number e.g. double 
+      * @tparam C a type of floating complex number e.g. std::complex<float> 
+      */
+    class StreamingStatistics {
+
+        Z nDOFs_;
+        Z Count_;
+
+        Vector<C> Mean_;
+        Vector<R> M2_;
+
+        Vector<R> Min_;
+        Vector<R> Max_;
+
+        Z nBins_;
+        R Lower_;
+        R Upper_;
+        Vector<Z> Histogram_;
+
+        // five P^2 markers for each dof and probability 
+        Vector<R> Probabilities_;
+        Vector<R> Heights_;
+        Vector<R> Positions_;
+        Vector<R> Desired_;
+
+        public: 
+
+        /**
+          * @brief 
+          * Create an empty accumulator 
+          * 
+          * @param nDOFs         number of responses per sample 
+          * @param Probabilities probabilities of quantiles to estimate 
+          * @param nBins         number of histogram bins, 0 for no histogram 
+          * @param Lower         lower edge of the histogram of |u| 
+          * @param Upper         upper edge of the histogram of |u| 
+          */
+        StreamingStatistics ( 
+
+            const Z nDOFs, 
+            const Vector<R>& Probabilities = Vector<R> (), 
+            const Z nBins = 0, 
+            const R Lower = 0.0, 
+            const R Upper = 1.0 
+
+        );
+
+        /**
+          * @brief 
+          * Add a chunk of responses { Sample1, Sample2, ... }, each sample 
+          * has nDOFs entries. Chunk moments are computed by two passes and 
+          * combined with the running moments pairwise. 
+          */
+        void Add ( const Vector<C>& Responses );
+        void Add ( const C* Responses, const Z nPoints );
+
+        /**
+          * @brief 
+          * Combine with another accumulator of the same configuration. 
+          * Moments, extremes and histograms are exact, quantiles are 
+          * approximated by count-weighted P^2 markers. 
+          */
+        void Merge ( const StreamingStatistics& Other );
+
+        Z nDOFs () const { return nDOFs_; }
+        Z Count () const { return Count_; }
+
+        const Vector<C>& Mean () const { return Mean_; }
+        const Vector<R>& Min  () const { return Min_; }
+        const Vector<R>& Max  () const { return Max_; }
+
+        /**
+          * @return sample variance E|u - mean|^2 per dof, zero below 2 samples 
+          */
+        Vector<R> Variance () const;
+
+        /**
+          * @return counts of |u| per dof { Dof1 bins, Dof2 bins, ... }, 
+          *         values outside [ Lower, Upper ) go to the edge bins 
+          */
+        const Vector<Z>& Histogram () const { return Histogram_; }
+
+        /**
+          * @return quantiles of |u| { Dof1 quantiles, Dof2 quantiles, ... } 
+          */
+        Vector<R> Quantiles () const;
+
+        private: 
+
+        void AddQuantile ( const Z Set, const R x, const Z n );
+
+    };
+
+} // MonteCarlo : StreamingStatistics 
+
+
+namespace MonteCarlo {
+
+    template < typename Z, typename R >
+    /**
+      * @class CorrelatedSampler 
+      * 
+      * @brief 
+      * Reusable map from independent standard normal points to correlated 
+      * points and, through the normal CDF, to arbitrary marginals. The 
+      * Cholesky factor is computed once and kept packed by rows. All 
+      * operations work in place on point-major chunks { Point1, ... } and 
+      * do not allocate. @n 
+      * Implemented in @ref _CorrelatedSampler_imp_hpp_ 
+      * 
+      * @tparam Z a type of non-negative integer e.g. size_t 
+      * @tparam R a type of floating number e.g. double 
+      */
+    class CorrelatedSampler {
+
+        Z Dim_;
+
+        // rows of the lower Cholesky factor, row i starts at i(i+1)/2 
+        Vector<R> Lower_;
+
+        public: 
+
+        /**
+          * @param Correl correlation matrix, empty for independent variables 
+          */
+        CorrelatedSampler ( const MatrixXT<R>& Correl );
+
+        /**
+          * @brief 
+          * Multiply each point by the Cholesky factor in place. Rows are 
+          * updated from the last one up, so no workspace is needed. 
+          */
+        void Correlate ( R* Points, const Z nPoints ) const;
+
+        template < class... ICDFs >
+        /**
+          * @brief 
+          * Correlate, map to (0,1) by @ref NormalCDF, then apply one inverse 
+          * CDF functor per dimension. Functors are template arguments so 
+          * calls inline, e.g. lambdas or boost quantile wrappers. 
+          */
+        void Transform ( R* Points, const Z nPoints, const ICDFs&... Icdfs ) const;
+
+        /**
+          * @brief 
+          * Same as the variadic Transform with type-erased inverse CDFs 
+          */
+        void Transform ( 
+
+            R* Points, 
+            const Z nPoints, 
+            const Vector< std::function<R(R)> >& Icdfs 
+
+        ) const;
+
+        /**
+          * @return number of variables, 0 for an empty correlation matrix 
+          */
+        Z Dim () const { return Dim_; }
+
+        private: 
+
+        template < std::size_t... J, class... ICDFs >
+        void ApplyICDFs ( 
+
+            R* Points, 
+            const Z nPoints, 
+            std::index_sequence<J...>, 
+            const ICDFs&... Icdfs 
+
+        ) const;
+
+    };
+
+} // MonteCarlo : CorrelatedSampler 
+
+
+namespace MonteCarlo {
+
+    template < typename Z, typename R >
+    /**
+      * @class NatafTransformation 
+      * 
+      * @brief 
+      * Nataf model of a random vector with given marginals and target 
+      * ( Pearson ) correlation in physical space. The fictive correlation 
+      * of the underlying standard normal vector is solved once in the 
+      * constructor, pair by pair, from the bivariate integral equation 
+      * evaluated by tensor Gauss-Hermite quadrature, and cached together 
+      * with its Cholesky factor. @n 
+      * Implemented in @ref _Nataf_imp_hpp_ 
+      * 
+      * @tparam Z a type of non-negative integer e.g. size_t 
+      * @tparam R a type of floating number e.g. double 
+      */
+    class NatafTransformation {
+
+        Vector< std::function<R(R)> > ICDFs_;
+
+        MatrixXT<R> Fictive_;
+
+        CorrelatedSampler<Z,R> Sampler_;
+
+        public: 
+
+        /**
+          * @param Correl      target correlation of the physical variables 
+          * @param ICDFs       inverse CDF of each marginal 
+          * @param nQuadrature Gauss-Hermite nodes per dimension 
+          */
+        NatafTransformation ( 
+
+            const MatrixXT<R>& Correl, 
+            const Vector< std::function<R(R)> >& ICDFs, 
+            const Z nQuadrature = 32 
+
+        );
+
+        /**
+          * @brief 
+          * Map independent standard normal points { Point1, ... } to 
+          * physical points in place 
+          */
+        void Transform ( R* Points, const Z nPoints ) const;
+
+        /**
+          * @brief 
+          * Correlation of the underlying standard normal vector 
+          */
+        const MatrixXT<R>& FictiveCorrelation () const { return Fictive_; }
+
+        /**
+          * @brief 
+          * Cached sampler of the fictive correlation, its variadic 
+          * Transform with inline inverse CDF functors is the fastest path 
+          */
+        const CorrelatedSampler<Z,R>& Sampler () const { return Sampler_; }
+
+        private: 
+
+        static MatrixXT<R> SolveFictive ( 
+
+            const MatrixXT<R>& Correl, 
+            const Vector< std::function<R(R)> >& ICDFs, 
+            const Z nQuadrature 
+
+        );
+
+    };
+
+} // MonteCarlo : NatafTransformation 
+
+
+namespace MonteCarlo {
+
+    template < typename Z, typename R >
+    /**
+      * @class SampleGenerator 
+      * 
+      * @brief 
+      * Stream of standard normal, optionally correlated, random points 
+      * written chunk by chunk into caller-owned memory. Point k of the 
+      * stream only depends on the configuration and k, so the whole state 
+      * is the position: a campaign resumes by constructing the generator 
+      * with the same arguments and calling Seek with the saved Position. 
+      * Pseudo-random points equal @ref RandomSampling with the same seed, 
+      * quasi-random points are Owen-scrambled Sobol points mapped by 
+      * @ref InverseNormalCDF. @n 
+      * Implemented in @ref _SampleGenerator_imp_hpp_ 
+      * 
+      * @tparam Z a type of non-negative integer e.g. size_t 
+      * @tparam R a type of floating number e.g. double 
+      */
+    class SampleGenerator {
+
+        Z Dim_;
+        std::uint64_t Seed_;
+        bool QuasiRandom_;
+
+        Z Position_;
+
+        CorrelatedSampler<Z,R> Correlation_;
+
+        public: 
+
+        /**
+          * @param Dim         dimension of each point 
+          * @param Seed        seed of the stream 
+          * @param Correl      correlation matrix, empty for independent 
+          * @param QuasiRandom scrambled Sobol instead of Philox, Dim <= 21 
+          */
+        SampleGenerator ( 
+
+            const Z Dim, 
+            const std::uint64_t Seed, 
+            const MatrixXT<R>& Correl = MatrixXT<R> (), 
+            const bool QuasiRandom = false 
+
+        );
+
+        /**
+          * @brief 
+          * Write the next nPoints points { Point1, Point2, ... } to Buffer, 
+          * which must hold nPoints * Dim values, and advance the position 
+          */
+        void Next ( R* Buffer, const Z nPoints );
+
+        /**
+          * @brief 
+          * Continue from a saved position 
+          */
+        void Seek ( const Z Position ) { Position_ = Position; }
+
+        Z Position () const { return Position_; }
+        Z Dim () const { return Dim_; }
+
+        std::uint64_t Seed () const { return Seed_; }
+
+    };
+
+} // MonteCarlo : SampleGenerator 
+
+
+#ifndef PHILOX_IMPLEMENTATIONS 
+    #include "Philox_imp.hpp" 
+#endif 
+
+#ifndef NORMAL_DISTRIBUTION_IMPLEMENTATIONS 
+    #include "NormalDistribution_imp.hpp" 
+#endif 
+
 #ifndef LATIN_HYPERCUBE_SAMPLING_IMPLEMENTATIONS 
     #include "LatinHypercubeSampling_imp.hpp" 
 #endif 
 
+#ifndef QUASI_MONTE_CARLO_IMPLEMENTATIONS 
+    #include "QuasiMonteCarlo_imp.hpp" 
+#endif 
+
 #ifndef VARIABLE_GENERATION_IMPLEMENTATIONS 
     #include "VariableGeneration_imp.hpp" 
 #endif 
 
+#ifndef STREAMING_STATISTICS_IMPLEMENTATIONS 
+    #include "StreamingStatistics_imp.hpp" 
+#endif 
+
+#ifndef CORRELATED_SAMPLER_IMPLEMENTATIONS 
+    #include "CorrelatedSampler_imp.hpp" 
+#endif 
+
+#ifndef NATAF_IMPLEMENTATIONS 
+    #include "Nataf_imp.hpp" 
+#endif 
+
+#ifndef SAMPLE_GENERATOR_IMPLEMENTATIONS 
+    #include "SampleGenerator_imp.hpp" 
+#endif 
+
 #ifndef ANALYTICAL_MODEL_IMPLEMENTATIONS 
     #include "AnalyticalModel_imp.hpp" 
 #endif 
@@ -0,0 +1,175 @@
+/**
+  * @file CorrelatedSampler_imp.hpp 
+  *
+  * @brief 
+  * Implementations of reusable correlated random variable transformation 
+  * 
+  * @anchor _CorrelatedSampler_imp_hpp_ 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#ifndef CORRELATED_SAMPLER_IMPLEMENTATIONS 
+#define CORRELATED_SAMPLER_IMPLEMENTATIONS 
+
+#ifndef MONTE_CARLO_DECLARATIONS 
+    #include "MonteCarlo.hpp" 
+#endif 
+
+
+namespace MonteCarlo {
+
+    template < typename Z, typename R >
+    CorrelatedSampler<Z,R>::CorrelatedSampler ( 
+
+        const MatrixXT<R>& Correl 
+
+    ) : Dim_ ( Correl.rows() ) {
+
+        if ( Correl.rows() != Correl.cols() ) {
+
+            throw std::runtime_error (
+                "CorrelatedSampler: correlation matrix must be square"
+            );
+
+        }
+
+        if ( Dim_ == 0 ) return;
+
+        Eigen::LLT<MatrixXT<R>> Cholesky ( Correl );
+
+        if ( Cholesky.info() != Eigen::Success ) {
+
+            throw std::runtime_error (
+                "CorrelatedSampler: correlation matrix is not positive definite"
+            );
+
+        }
+
+        MatrixXT<R> L = Cholesky.matrixL();
+
+        Lower_.resize ( Dim_ * ( Dim_ + 1 ) / 2 );
+
+        for ( Z i = 0; i < Dim_; i++ ) {
+        for ( Z j = 0; j <= i; j++ ) {
+
+            Lower_[i*(i+1)/2+j] = L(i,j);
+
+        }
+        }
+
+    } // Constructor 
+
+
+    template < typename Z, typename R >
+    void CorrelatedSampler<Z,R>::Correlate ( R* Points, const Z nPoints ) const {
+
+        if ( Dim_ == 0 ) return;
+
+        for ( Z p = 0; p < nPoints; p++ ) {
+
+            R* x = Points + p * Dim_;
+
+            // row i only reads entries j <= i, which are not yet overwritten 
+            for ( Z i = Dim_; i-- > 0; ) {
+
+                const R* l = Lower_.data() + i * ( i + 1 ) / 2;
+
+                R Sum = 0.0;
+
+                for ( Z j = 0; j <= i; j++ ) Sum += l[j] * x[j];
+
+                x[i] = Sum;
+
+            }
+
+        }
+
+    } // Correlate 
+
+
+    template < typename Z, typename R >
+    template < class... ICDFs >
+    void CorrelatedSampler<Z,R>::Transform ( 
+
+        R* Points, const Z nPoints, const ICDFs&... Icdfs 
+
+    ) const {
+
+        if ( sizeof...( ICDFs ) != Dim_ ) {
+
+            throw std::runtime_error (
+                "CorrelatedSampler: need one inverse CDF per dimension"
+            );
+
+        }
+
+        Correlate ( Points, nPoints );
+
+        NormalCDF<Z,R> ( Points, nPoints * Dim_, Points );
+
+        ApplyICDFs ( 
+            Points, nPoints, std::index_sequence_for<ICDFs...> (), Icdfs... 
+        );
+
+    } // Transform 
+
+
+    template < typename Z, typename R >
+    void CorrelatedSampler<Z,R>::Transform ( 
+
+        R* Points, 
+        const Z nPoints, 
+        const Vector< std::function<R(R)> >& Icdfs 
+
+    ) const {
+
+        if ( Icdfs.size() != Dim_ ) {
+
+            throw std::runtime_error (
+                "CorrelatedSampler: need one inverse CDF per dimension"
+            );
+
+        }
+
+        Correlate ( Points, nPoints );
+
+        NormalCDF<Z,R> ( Points, nPoints * Dim_, Points );
+
+        for ( Z p = 0; p < nPoints; p++ ) {
+        for ( Z j = 0; j < Dim_; j++ ) {
+
+            Points[p*Dim_+j] = Icdfs[j] ( Points[p*Dim_+j] );
+
+        }
+        }
+
+    } // Transform 
+
+
+    template < typename Z, typename R >
+    template < std::size_t... J, class... ICDFs >
+    void CorrelatedSampler<Z,R>::ApplyICDFs ( 
+
+        R* Points, 
+        const Z nPoints, 
+        std::index_sequence<J...>, 
+        const ICDFs&... Icdfs 
+
+    ) const {
+
+        for ( Z p = 0; p < nPoints; p++ ) {
+
+            R* x = Points + p * Dim_;
+
+            ( ( x[J] = Icdfs ( x[J] ) ), ... );
+
+        }
+
+    } // ApplyICDFs 
+
+} // MonteCarlo : CorrelatedSampler 
+
+#endif // CORRELATED_SAMPLER_IMPLEMENTATIONS 
@@ -41,6 +41,54 @@ namespace MonteCarlo {
     Vector<R> UnsortedLHS ( const Z nPoints, const Z Dim );
 
 
+    template < typename Z, typename R >
+    /**
+      * @private 
+      * 
+      * @brief 
+      * Reproducible UnsortedLHS. Permutation of dimension i is drawn from 
+      * @ref _Philox_ stream 2i and the position of point k inside its 
+      * interval from block k/2 of stream 2i+1, so each dimension can be 
+      * generated independently. 
+      * 
+      * @param nPoints number of sampled points 
+      * @param Dim     dimension of each point 
+      * @param Seed    seed of the generator 
+      * 
+      * @return vector { Dim1, Dim2, ... }
+      */
+    Vector<R> UnsortedLHS ( const Z nPoints, const Z Dim, const std::uint64_t Seed );
+
+
+    template < typename Z, typename R >
+    /**
+      * @private 
+      * 
+      * @brief 
+      * Seeded latin hypercube written with arbitrary strides, variable i of 
+      * point k goes to Samples[ k * PointStride + i * DimStride ]. The 
+      * permutation is shuffled inside the output itself, so no buffer 
+      * beyond the samples is needed. 
+      * 
+      * @param nPoints     number of sampled points 
+      * @param Dim         dimension of each point 
+      * @param Seed        seed of the generator 
+      * @param PointStride distance between consecutive points 
+      * @param DimStride   distance between consecutive dimensions 
+      * @param Samples     output of size nPoints * Dim 
+      */
+    void FillLHS ( 
+
+        const Z nPoints, 
+        const Z Dim, 
+        const std::uint64_t Seed, 
+        const Z PointStride, 
+        const Z DimStride, 
+        R* Samples 
+
+    );
+
+
     template < typename Z >
     /**
       * @private 
@@ -90,10 +138,24 @@ namespace MonteCarlo {
     template < typename Z, typename R >
     Vector<R> LHS ( const Z nPoints, const Z Dim ) {
 
-        auto Samples = UnsortedLHS<Z,R> ( nPoints, Dim );
-        auto SorterIndices = TransposerIndices<Z> ( nPoints, Dim );
+        std::random_device device;
+
+        std::uint64_t Seed = std::uint64_t ( device() ) << 32 | device();
+
+        return LHS<Z,R> ( nPoints, Dim, Seed );
+
+    }
+
 
-        return SortLHS<Z,R> ( Samples, SorterIndices );
+    template < typename Z, typename R >
+    Vector<R> LHS ( const Z nPoints, const Z Dim, const std::uint64_t Seed ) {
+
+        // point-major directly, same values as sorting UnsortedLHS 
+        Vector<R> result ( nPoints * Dim );
+
+        FillLHS<Z,R> ( nPoints, Dim, Seed, Dim, 1, result.data() );
+
+        return result;
 
     }
 
@@ -103,74 +165,320 @@ namespace MonteCarlo {
 namespace MonteCarlo {
 
     template < typename Z, typename R >
-    Vector<R> UnsortedLHS ( const Z nPoints, const Z Dim ) {
+    Vector<R> OptimizedLHS ( 
 
-        if ( nPoints < 1 ) {
+        const Z nPoints, 
+        const Z Dim, 
+        const std::uint64_t Seed, 
+        const Z nIterations, 
+        const Z p 
+
+    ) {
+
+        if ( p < 1 ) {
 
             throw std::runtime_error (
-                "LHS: Number of points must be positive integer"
+                "OptimizedLHS: exponent must be positive integer"
             );
 
         }
 
-        if ( Dim < 1 ) {
+        // columns are contiguous, swaps keep the latin hypercube property 
+        auto Samples = UnsortedLHS<Z,R> ( nPoints, Dim, Seed );
 
-            throw std::runtime_error (
-                "LHS: dimension must be positive integer"
+        // interval indices by rank, robust against rounding of x * nPoints 
+        Vector<R> Levels ( nPoints * Dim );
+        Vector<Z> Order  ( nPoints );
+
+        for ( auto k = 0; k < Dim; k++ ) {
+
+            const R* x = Samples.data() + k * nPoints;
+
+            std::iota ( Order.begin(), Order.end(), 0 );
+
+            std::sort ( 
+                Order.begin(), Order.end(), 
+                [x]( const Z a, const Z b ) { return x[a] < x[b]; } 
             );
 
+            for ( auto l = 0; l < nPoints; l++ ) Levels[k*nPoints+Order[l]] = l;
+
         }
 
-        R range = 1.0 / nPoints;
+        // d^-p from squared distance, rows differ by at least one per column 
+        auto Term = [p]( const R d2 ) {
+
+            R Base   = R(1.0) / d2;
+            R result = p % 2 ? std::sqrt ( Base ) : R(1.0);
+
+            for ( Z e = p / 2; e > 0; e >>= 1 ) {
+
+                if ( e & 1 ) result *= Base;
+                Base *= Base;
+
+            }
+
+            return result;
+
+        };
+
+        Vector<R> Dist1 ( nPoints ), Dist2 ( nPoints );
+
+        // squared distances of one row to all rows 
+        auto RowDistances = [&Levels,nPoints,Dim]( const Z Row, R* Dist ) {
+
+            std::fill ( Dist, Dist + nPoints, 0.0 );
+
+            for ( auto k = 0; k < Dim; k++ ) {
+
+                const R* L = Levels.data() + k * nPoints;
+
+                for ( auto j = 0; j < nPoints; j++ ) {
+
+                    Dist[j] += ( L[Row] - L[j] ) * ( L[Row] - L[j] );
+
+                }
+
+            }
+
+        };
+
+        R Sum = 0.0;
+
+        for ( Z i = 0; i < nPoints; i++ ) {
+
+            RowDistances ( i, Dist1.data() );
+
+            for ( Z j = i + 1; j < nPoints; j++ ) Sum += Term ( Dist1[j] );
+
+        }
+
+
+        // ===================================================================== 
+        // Simulated annealing on the relative change of phi_p 
+        // ===================================================================== 
+
+        Z nIter = nIterations > 0 ? nIterations : 100 * nPoints;
+
+        const R T0 = 1e-2, T1 = 1e-5;
+
+        Philox generator ( Seed, 2 * Dim );
+
+        R BestSum = Sum;
+
+        // accepted swaps { k, i1, i2 } since the best state, undone at the 
+        // end instead of copying the design on every improvement 
+        std::vector<std::array<Z,3>> Swaps;
+
+        // best design, only stored once the log outgrows the design 
+        Vector<R> Best;
+        bool Logging = true;
+
+        auto Undo = [&Swaps,nPoints]( Vector<R>& Design ) {
+
+            for ( auto s = Swaps.rbegin(); s != Swaps.rend(); s++ ) {
+
+                R* x = Design.data() + (*s)[0] * nPoints;
+
+                std::swap ( x[(*s)[1]], x[(*s)[2]] );
+
+            }
+
+        };
+
+        for ( Z it = 0; it < nIter && nPoints > 1; it++ ) {
+
+            Z k  = it % Dim;
+            Z i1 = generator() % nPoints;
+            Z i2 = generator() % ( nPoints - 1 );
+
+            if ( i2 >= i1 ) i2++;
+
+            R* L = Levels.data() + k * nPoints;
+
+            R a = L[i1], b = L[i2];
+
+            RowDistances ( i1, Dist1.data() );
+            RowDistances ( i2, Dist2.data() );
+
+            // distance between i1 and i2 does not change 
+            R Delta = 0.0;
+
+            for ( Z j = 0; j < nPoints; j++ ) {
+
+                if ( j == i1 || j == i2 ) continue;
+
+                R Shift = ( b - L[j] ) * ( b - L[j] ) - ( a - L[j] ) * ( a - L[j] );
+
+                Delta += Term ( Dist1[j] + Shift ) - Term ( Dist1[j] );
+                Delta += Term ( Dist2[j] - Shift ) - Term ( Dist2[j] );
+
+            }
+
+            R Ratio = std::pow ( ( Sum + Delta ) / Sum, R(1.0) / p ) - R(1.0);
+
+            R T = T0 * std::pow ( T1 / T0, R(it) / R(nIter) );
+
+            // named draws, order of evaluating arguments is unspecified 
+            auto Hi = generator();
+            auto Lo = generator();
+
+            R u = Philox::Uniform<R> ( Hi, Lo );
+
+            if ( Ratio > 0.0 && u >= std::exp ( -Ratio / T ) ) continue;
+
+            std::swap ( L[i1], L[i2] );
+            std::swap ( Samples[k*nPoints+i1], Samples[k*nPoints+i2] );
+
+            Sum += Delta;
+
+            if ( Sum < BestSum ) {
+
+                BestSum = Sum;
+                Logging = true;
+
+                Swaps.clear();
+
+            } else if ( Logging ) {
+
+                Swaps.push_back ( { k, i1, i2 } );
+
+                // amortized, at least Samples.size() / 3 swaps per copy 
+                if ( 3 * Swaps.size() > Samples.size() ) {
+
+                    Best = Samples;
+                    Undo ( Best );
+
+                    Logging = false;
+
+                    Swaps.clear();
+
+                }
+
+            }
+
+        }
+
+        if ( Logging ) {
+
+            Undo ( Samples );
+            Best.swap ( Samples );
+
+        }
+
+        // cache-blocked transpose to point-major 
+        Vector<R> result ( nPoints * Dim );
+
+        Eigen::Map<MatrixXT<R>> ( result.data(), Dim, nPoints ) = 
+            Eigen::Map<const MatrixXT<R>> ( Best.data(), nPoints, Dim ).transpose();
+
+        return result;
+
+    }
+
+} // MonteCarlo : OptimizedLHS 
+
+
+namespace MonteCarlo {
+
+    template < typename Z, typename R >
+    Vector<R> UnsortedLHS ( const Z nPoints, const Z Dim ) {
 
         std::random_device device;
 
-        std::default_random_engine generator ( device () );
-        std::mt19937 shuffler ( device () );
+        std::uint64_t Seed = std::uint64_t ( device() ) << 32 | device();
 
-        std::uniform_real_distribution <R> RandomVariable ( 0.0, range );
+        return UnsortedLHS<Z,R> ( nPoints, Dim, Seed );
 
+    }
 
-        Vector<Z> IntervalIndices ( nPoints );
 
-        std::iota (
+    template < typename Z, typename R >
+    Vector<R> UnsortedLHS ( 
 
-            IntervalIndices.begin(),
-            IntervalIndices.end(),
-            0
+        const Z nPoints, 
+        const Z Dim, 
+        const std::uint64_t Seed 
 
-        );
+    ) {
 
         Vector<R> result ( nPoints * Dim );
 
-        for ( auto i = 0; i < Dim; i++ ) {
+        FillLHS<Z,R> ( nPoints, Dim, Seed, 1, nPoints, result.data() );
 
-            std::shuffle (
+        return result;
 
-                IntervalIndices.begin(),
-                IntervalIndices.end(),
-                shuffler
+    }
 
-            );
 
-            std::transform (
+    template < typename Z, typename R >
+    void FillLHS ( 
 
-                IntervalIndices.begin(),
-                IntervalIndices.end(),
+        const Z nPoints, 
+        const Z Dim, 
+        const std::uint64_t Seed, 
+        const Z PointStride, 
+        const Z DimStride, 
+        R* Samples 
 
-                result.begin() + i * nPoints,
+    ) {
 
-                [range, &RandomVariable, &generator ]( auto m ) {
-                    
-                    return m * range + RandomVariable ( generator );
-                    
-                }
+        if ( nPoints < 1 ) {
 
+            throw std::runtime_error (
+                "LHS: Number of points must be positive integer"
             );
 
         }
 
-        return result;
+        if ( Dim < 1 ) {
+
+            throw std::runtime_error (
+                "LHS: dimension must be positive integer"
+            );
+
+        }
+
+        R range = 1.0 / nPoints;
+
+        for ( auto i = 0; i < Dim; i++ ) {
+
+            // interval indices are exact in R up to 2^53 points 
+            R* x = Samples + i * DimStride;
+
+            for ( Z k = 0; k < nPoints; k++ ) x[k*PointStride] = k;
+
+            // Fisher-Yates, modulo bias is negligible with 64-bit words 
+            Philox shuffler ( Seed, 2 * i );
+
+            for ( Z k = nPoints - 1; k > 0; k-- ) {
+
+                std::uint64_t Word = std::uint64_t ( shuffler() ) << 32;
+                Word |= shuffler();
+
+                std::swap ( x[k*PointStride], x[(Word%(k+1))*PointStride] );
+
+            }
+
+            Philox generator ( Seed, 2 * i + 1 );
+
+            for ( Z k = 0; k < nPoints; k += 2 ) {
+
+                auto Words = generator.Block ( k / 2 );
+
+                x[k*PointStride] = range * ( 
+                    x[k*PointStride] + Philox::Uniform<R> ( Words[0], Words[1] ) 
+                );
+
+                if ( k + 1 == nPoints ) break;
+
+                x[(k+1)*PointStride] = range * ( 
+                    x[(k+1)*PointStride] + Philox::Uniform<R> ( Words[2], Words[3] ) 
+                );
+
+            }
+
+        }
 
     }
 
@@ -0,0 +1,227 @@
+/**
+  * @file Nataf_imp.hpp 
+  *
+  * @brief 
+  * Implementations of Nataf transformation with fictive correlation 
+  * 
+  * @anchor _Nataf_imp_hpp_ 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#ifndef NATAF_IMPLEMENTATIONS 
+#define NATAF_IMPLEMENTATIONS 
+
+#ifndef MONTE_CARLO_DECLARATIONS 
+    #include "MonteCarlo.hpp" 
+#endif 
+
+
+namespace MonteCarlo {
+
+    template < typename Z, typename R >
+    NatafTransformation<Z,R>::NatafTransformation ( 
+
+        const MatrixXT<R>& Correl, 
+        const Vector< std::function<R(R)> >& ICDFs, 
+        const Z nQuadrature 
+
+    ) : 
+        ICDFs_ ( ICDFs ), 
+        Fictive_ ( SolveFictive ( Correl, ICDFs, nQuadrature ) ), 
+        Sampler_ ( Fictive_ ) {
+
+    } // Constructor 
+
+
+    template < typename Z, typename R >
+    void NatafTransformation<Z,R>::Transform ( R* Points, const Z nPoints ) const {
+
+        Sampler_.Transform ( Points, nPoints, ICDFs_ );
+
+    } // Transform 
+
+
+    template < typename Z, typename R >
+    MatrixXT<R> NatafTransformation<Z,R>::SolveFictive ( 
+
+        const MatrixXT<R>& Correl, 
+        const Vector< std::function<R(R)> >& ICDFs, 
+        const Z nQuadrature 
+
+    ) {
+
+        Z Dim = Correl.rows();
+
+        if ( Correl.cols() != Dim || ICDFs.size() != Dim ) {
+
+            throw std::runtime_error (
+                "NatafTransformation: need square correlation and one ICDF per dimension"
+            );
+
+        }
+
+        if ( nQuadrature < 2 ) {
+
+            throw std::runtime_error (
+                "NatafTransformation: need at least two quadrature nodes"
+            );
+
+        }
+
+        Z q = nQuadrature;
+
+
+        // ===================================================================== 
+        // Gauss-Hermite rule for the standard normal by Golub-Welsch 
+        // ===================================================================== 
+
+        MatrixXT<R> Jacobi = MatrixXT<R>::Zero ( q, q );
+
+        for ( Z k = 1; k < q; k++ ) {
+
+            Jacobi(k,k-1) = Jacobi(k-1,k) = std::sqrt ( R(k) / R(2.0) );
+
+        }
+
+        Eigen::SelfAdjointEigenSolver<MatrixXT<R>> Solver ( Jacobi );
+
+        Vector<R> Nodes ( q ), Weights ( q );
+
+        for ( Z a = 0; a < q; a++ ) {
+
+            Nodes  [a] = std::sqrt ( R(2.0) ) * Solver.eigenvalues()(a);
+            Weights[a] = Solver.eigenvectors()(0,a) * Solver.eigenvectors()(0,a);
+
+        }
+
+
+        // ===================================================================== 
+        // Standardized marginals, probabilities kept inside (0,1) 
+        // ===================================================================== 
+
+        const R Lowest  = std::numeric_limits<R>::min();
+        const R Highest = R(1.0) - std::numeric_limits<R>::epsilon() / 2;
+
+        auto Probability = [Lowest,Highest]( R z ) {
+
+            R u;
+            NormalCDF<Z,R> ( &z, 1, &u );
+
+            return std::min ( std::max ( u, Lowest ), Highest );
+
+        };
+
+        Vector<R> Means ( Dim ), Deviations ( Dim );
+
+        // standardized values of each marginal at the nodes 
+        Vector<R> Standard ( Dim * q );
+
+        for ( Z i = 0; i < Dim; i++ ) {
+
+            R Mean = 0.0, Square = 0.0;
+
+            for ( Z a = 0; a < q; a++ ) {
+
+                R x = ICDFs[i] ( Probability ( Nodes[a] ) );
+
+                Standard[i*q+a] = x;
+
+                Mean   += Weights[a] * x;
+                Square += Weights[a] * x * x;
+
+            }
+
+            R Variance = Square - Mean * Mean;
+
+            if ( !( Variance > 0.0 ) ) {
+
+                throw std::runtime_error (
+                    "NatafTransformation: marginal has zero variance"
+                );
+
+            }
+
+            Means[i]      = Mean;
+            Deviations[i] = std::sqrt ( Variance );
+
+            for ( Z a = 0; a < q; a++ ) {
+
+                Standard[i*q+a] = ( Standard[i*q+a] - Mean ) / Deviations[i];
+
+            }
+
+        }
+
+
+        // ===================================================================== 
+        // Pairwise root of rho( rho0 ) = target 
+        // ===================================================================== 
+
+        MatrixXT<R> Fictive = MatrixXT<R>::Identity ( Dim, Dim );
+
+        for ( Z i = 0; i < Dim; i++ ) {
+        for ( Z j = i + 1; j < Dim; j++ ) {
+
+            R Target = R(0.5) * ( Correl(i,j) + Correl(j,i) );
+
+            // independent normals stay independent for any marginals 
+            if ( Target == 0.0 ) continue;
+
+            auto Residual = [&]( const R Rho0 ) {
+
+                R Complement = std::sqrt ( std::max ( R(0.0), R(1.0) - Rho0 * Rho0 ) );
+
+                R Sum = 0.0;
+
+                for ( Z b = 0; b < q; b++ ) {
+                for ( Z a = 0; a < q; a++ ) {
+
+                    R zj = Rho0 * Nodes[a] + Complement * Nodes[b];
+
+                    R xj = ( ICDFs[j] ( Probability ( zj ) ) - Means[j] ) / Deviations[j];
+
+                    Sum += Weights[a] * Weights[b] * Standard[i*q+a] * xj;
+
+                }
+                }
+
+                return Sum - Target;
+
+            };
+
+            R Lower = Residual ( -1.0 );
+            R Upper = Residual (  1.0 );
+
+            if ( Lower > 0.0 || Upper < 0.0 ) {
+
+                throw std::runtime_error (
+                    "NatafTransformation: correlation not attainable for given marginals"
+                );
+
+            }
+
+            boost::uintmax_t MaxIter = 100;
+
+            auto Root = boost::math::tools::toms748_solve ( 
+                Residual, R(-1.0), R(1.0), Lower, Upper, 
+                boost::math::tools::eps_tolerance<R> ( 
+                    std::numeric_limits<R>::digits - 10 
+                ), 
+                MaxIter 
+            );
+
+            Fictive(i,j) = Fictive(j,i) = R(0.5) * ( Root.first + Root.second );
+
+        }
+        }
+
+        return Fictive;
+
+    } // SolveFictive 
+
+} // MonteCarlo : NatafTransformation 
+
+#endif // NATAF_IMPLEMENTATIONS 
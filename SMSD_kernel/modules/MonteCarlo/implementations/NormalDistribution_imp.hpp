@@ -0,0 +1,148 @@
+/**
+  * @file NormalDistribution_imp.hpp 
+  *
+  * @brief 
+  * Implementations of buffer-wide standard normal CDF and its inverse 
+  * 
+  * @anchor _NormalDistribution_imp_hpp_ 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#ifndef NORMAL_DISTRIBUTION_IMPLEMENTATIONS 
+#define NORMAL_DISTRIBUTION_IMPLEMENTATIONS 
+
+#ifndef MONTE_CARLO_DECLARATIONS 
+    #include "MonteCarlo.hpp" 
+#endif 
+
+
+namespace MonteCarlo {
+
+    template < typename Z, typename R >
+    void InverseNormalCDF ( const R* P, const Z nPoints, R* X ) {
+
+        // Acklam's coefficients, central region and lower tail 
+        const R a[6] = { 
+            -3.969683028665376e+01,  2.209460984245205e+02, 
+            -2.759285104469687e+02,  1.383577518672690e+02, 
+            -3.066479806614716e+01,  2.506628277459239e+00 
+        };
+
+        const R b[5] = { 
+            -5.447609879822406e+01,  1.615858368580409e+02, 
+            -1.556989798598866e+02,  6.680131188771972e+01, 
+            -1.328068155288572e+01 
+        };
+
+        const R c[6] = { 
+            -7.784894002430293e-03, -3.223964580411365e-01, 
+            -2.400758277161838e+00, -2.549732539343734e+00, 
+             4.374664141464968e+00,  2.938163982698783e+00 
+        };
+
+        const R d[4] = { 
+             7.784695709041462e-03,  3.224671290700398e-01, 
+             2.445134137142996e+00,  3.754408661907416e+00 
+        };
+
+        const R Split      = 0.02425;
+        const R InvSqrt2   = 1.0 / std::sqrt ( R(2.0) );
+        const R SqrtTwoPi  = std::sqrt ( 2.0 * boost::math::constants::pi<R>() );
+        const R Infinity   = std::numeric_limits<R>::infinity();
+
+
+        // tiles keep the approximations in cache and allow X to alias P 
+        const Z Tile = 256;
+
+        R Approx [ Tile ];
+
+        for ( Z i0 = 0; i0 < nPoints; i0 += Tile ) {
+
+            const Z nTile = std::min ( Tile, nPoints - i0 );
+
+
+            // ================================================================= 
+            // Rational approximation, branch-free so that the loop vectorizes 
+            // ================================================================= 
+
+            #ifdef _OPENMP 
+            #pragma omp simd 
+            #endif 
+            for ( Z k = 0; k < nTile; k++ ) {
+
+                R p = P[i0+k];
+
+                // smaller tail, 1 - p is exact for p >= 0.5 
+                R s = std::min ( p, R(1.0) - p );
+
+                R q = p - R(0.5);
+                R r = q * q;
+
+                R Central = 
+                    ( ( ( ( ( a[0]*r + a[1] )*r + a[2] )*r + a[3] )*r + a[4] )*r + a[5] ) * q / 
+                    ( ( ( ( ( b[0]*r + b[1] )*r + b[2] )*r + b[3] )*r + b[4] )*r + 1.0 );
+
+                R t = std::sqrt ( R(-2.0) * std::log ( s ) );
+
+                R Tail = 
+                    ( ( ( ( ( c[0]*t + c[1] )*t + c[2] )*t + c[3] )*t + c[4] )*t + c[5] ) / 
+                    ( ( ( ( d[0]*t + d[1] )*t + d[2] )*t + d[3] )*t + 1.0 );
+
+                // lower-tail value -|x| 
+                Approx[k] = s < Split ? Tail : -std::abs ( Central );
+
+            }
+
+
+            // ================================================================= 
+            // One Halley step on the smaller tail, then restore sign 
+            // ================================================================= 
+
+            for ( Z k = 0; k < nTile; k++ ) {
+
+                R p = P[i0+k];
+                R s = std::min ( p, R(1.0) - p );
+                R z = Approx[k];
+
+                R e = R(0.5) * std::erfc ( -z * InvSqrt2 ) - s;
+                R u = e * SqrtTwoPi * std::exp ( R(0.5) * z * z );
+
+                // exp overflows only deep in the tail, keep Acklam's value 
+                if ( std::isfinite ( u ) ) z -= u / ( R(1.0) + R(0.5) * z * u );
+
+                if ( s == 0.0 ) z = -Infinity;
+                if ( !( s >= 0.0 ) ) z = std::numeric_limits<R>::quiet_NaN();
+
+                X[i0+k] = p < 0.5 ? z : -z;
+
+            }
+
+        }
+
+    }
+
+} // MonteCarlo : InverseNormalCDF 
+
+
+namespace MonteCarlo {
+
+    template < typename Z, typename R >
+    void NormalCDF ( const R* X, const Z nPoints, R* P ) {
+
+        const R InvSqrt2 = 1.0 / std::sqrt ( R(2.0) );
+
+        for ( Z i = 0; i < nPoints; i++ ) {
+
+            P[i] = R(0.5) * std::erfc ( -X[i] * InvSqrt2 );
+
+        }
+
+    }
+
+} // MonteCarlo : NormalCDF 
+
+
+#endif // NORMAL_DISTRIBUTION_IMPLEMENTATIONS 
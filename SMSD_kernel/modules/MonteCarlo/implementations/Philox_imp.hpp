@@ -0,0 +1,113 @@
+/**
+  * @file Philox_imp.hpp 
+  *
+  * @brief 
+  * Implementations of counter-based random number generator 
+  * 
+  * @anchor _Philox_imp_hpp_ 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#ifndef PHILOX_IMPLEMENTATIONS 
+#define PHILOX_IMPLEMENTATIONS 
+
+#ifndef MONTE_CARLO_DECLARATIONS 
+    #include "MonteCarlo.hpp" 
+#endif 
+
+
+namespace MonteCarlo {
+
+    inline Philox::Philox ( 
+
+        const std::uint64_t Seed, const std::uint64_t Stream 
+
+    ) : Stream_ ( Stream ), Counter_ ( 0 ), Index_ ( 4 ) {
+
+        Key_[0] = std::uint32_t ( Seed );
+        Key_[1] = std::uint32_t ( Seed >> 32 );
+
+    } // Constructor 
+
+
+    inline std::array<std::uint32_t,4> Philox::Block ( 
+
+        const std::uint64_t Counter 
+
+    ) const {
+
+        const std::uint64_t M0 = 0xD2511F53;
+        const std::uint64_t M1 = 0xCD9E8D57;
+
+        const std::uint32_t W0 = 0x9E3779B9;
+        const std::uint32_t W1 = 0xBB67AE85;
+
+        // block index in the low words, stream in the high words 
+        std::uint32_t c0 = std::uint32_t ( Counter );
+        std::uint32_t c1 = std::uint32_t ( Counter >> 32 );
+        std::uint32_t c2 = std::uint32_t ( Stream_ );
+        std::uint32_t c3 = std::uint32_t ( Stream_ >> 32 );
+
+        std::uint32_t k0 = Key_[0];
+        std::uint32_t k1 = Key_[1];
+
+        for ( auto r = 0; r < 10; r++ ) {
+
+            std::uint64_t p0 = M0 * c0;
+            std::uint64_t p1 = M1 * c2;
+
+            std::uint32_t n0 = std::uint32_t ( p1 >> 32 ) ^ c1 ^ k0;
+            std::uint32_t n1 = std::uint32_t ( p1 );
+            std::uint32_t n2 = std::uint32_t ( p0 >> 32 ) ^ c3 ^ k1;
+            std::uint32_t n3 = std::uint32_t ( p0 );
+
+            c0 = n0; c1 = n1; c2 = n2; c3 = n3;
+
+            k0 += W0;
+            k1 += W1;
+
+        }
+
+        return { c0, c1, c2, c3 };
+
+    } // Block 
+
+
+    inline Philox::result_type Philox::operator() () {
+
+        if ( Index_ == 4 ) {
+
+            Buffer_ = Block ( Counter_++ );
+            Index_  = 0;
+
+        }
+
+        return Buffer_[Index_++];
+
+    } // operator() 
+
+
+    inline void Philox::Seek ( const std::uint64_t Block ) {
+
+        Counter_ = Block;
+        Index_   = 4;
+
+    } // Seek 
+
+
+    template < typename R >
+    R Philox::Uniform ( const std::uint32_t Hi, const std::uint32_t Lo ) {
+
+        std::uint64_t Bits = ( std::uint64_t ( Hi ) << 32 | Lo ) >> 12;
+
+        // centre of one of 2^52 cells, representable so never 0 or 1 
+        return ( R ( Bits ) + R ( 0.5 ) ) * R ( 1.0 / 4503599627370496.0 );
+
+    } // Uniform 
+
+} // MonteCarlo : Philox 
+
+#endif // PHILOX_IMPLEMENTATIONS 
@@ -0,0 +1,418 @@
+/**
+  * @file QuasiMonteCarlo_imp.hpp 
+  *
+  * @brief 
+  * Implementations of low-discrepancy sample generators 
+  * 
+  * @anchor _QuasiMonteCarlo_imp_hpp_ 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#ifndef QUASI_MONTE_CARLO_IMPLEMENTATIONS 
+#define QUASI_MONTE_CARLO_IMPLEMENTATIONS 
+
+#ifndef MONTE_CARLO_DECLARATIONS 
+    #include "MonteCarlo.hpp" 
+#endif 
+
+
+namespace MonteCarlo {
+
+
+    template < typename Z >
+    /**
+      * @private 
+      * 
+      * @brief 
+      * 32-bit direction numbers of the first Dim Sobol dimensions. 
+      * 
+      * @return vector { Dim1 V0..V31, Dim2 V0..V31, ... } 
+      */
+    Vector<std::uint32_t> SobolDirections ( const Z Dim );
+
+
+    /**
+      * @private 
+      * 
+      * @brief 
+      * Owen scramble of a 32-bit fraction, Laine-Karras style hash on the 
+      * reversed bits so that each bit only depends on more significant ones 
+      */
+    inline std::uint32_t NestedUniformScramble ( std::uint32_t x, const std::uint32_t Seed );
+
+
+    template < typename Z >
+    /**
+      * @private 
+      * 
+      * @brief 
+      * 32-bit Sobol points of indices First, First + 1, ... in Gray-code 
+      * order, after checking the inputs. 
+      * 
+      * @return vector { Point1, Point2, ... } 
+      */
+    Vector<std::uint32_t> SobolBits ( 
+
+        const Z nPoints, 
+        const Z Dim, 
+        const std::uint64_t First 
+
+    );
+
+
+} // MonteCarlo : QMC SubFunctions Declarations 
+
+
+namespace MonteCarlo {
+
+    template < typename Z >
+    Vector<std::uint32_t> SobolDirections ( const Z Dim ) {
+
+        // new-joe-kuo-6.21201: degree s, coefficients a, initial m 
+        const Z nTable = 20;
+
+        const unsigned Degree [nTable] = { 
+            1, 2, 3, 3, 4, 4, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 7, 7 
+        };
+
+        const unsigned Coeffs [nTable] = { 
+            0, 1, 1, 2, 1, 4, 2, 4, 7, 11, 13, 14, 1, 13, 16, 19, 22, 25, 1, 4 
+        };
+
+        const unsigned Initial [nTable][7] = { 
+            { 1 }, 
+            { 1, 3 }, 
+            { 1, 3, 1 }, 
+            { 1, 1, 1 }, 
+            { 1, 1, 3, 3 }, 
+            { 1, 3, 5, 13 }, 
+            { 1, 1, 5, 5, 17 }, 
+            { 1, 1, 5, 5, 5 }, 
+            { 1, 1, 7, 11, 19 }, 
+            { 1, 1, 5, 1, 1 }, 
+            { 1, 1, 1, 3, 11 }, 
+            { 1, 3, 5, 5, 31 }, 
+            { 1, 3, 3, 9, 7, 49 }, 
+            { 1, 1, 1, 15, 21, 21 }, 
+            { 1, 3, 1, 13, 27, 49 }, 
+            { 1, 1, 1, 15, 7, 5 }, 
+            { 1, 3, 1, 15, 13, 25 }, 
+            { 1, 1, 5, 5, 19, 61 }, 
+            { 1, 3, 7, 11, 23, 15, 103 }, 
+            { 1, 3, 7, 13, 13, 15, 69 } 
+        };
+
+        Vector<std::uint32_t> V ( 32 * Dim );
+
+        // first dimension is the van der Corput sequence 
+        for ( auto k = 0; k < 32; k++ ) V[k] = std::uint32_t(1) << ( 31 - k );
+
+        for ( Z j = 1; j < Dim; j++ ) {
+
+            std::uint32_t* v = V.data() + 32 * j;
+
+            auto s = Degree [j-1];
+            auto a = Coeffs [j-1];
+
+            for ( auto k = 0; k < s; k++ ) {
+
+                v[k] = std::uint32_t ( Initial[j-1][k] ) << ( 31 - k );
+
+            }
+
+            for ( auto k = s; k < 32; k++ ) {
+
+                v[k] = v[k-s] ^ ( v[k-s] >> s );
+
+                for ( auto l = 1; l < s; l++ ) {
+
+                    if ( ( a >> ( s - 1 - l ) ) & 1 ) v[k] ^= v[k-l];
+
+                }
+
+            }
+
+        }
+
+        return V;
+
+    }
+
+
+    inline std::uint32_t NestedUniformScramble ( 
+
+        std::uint32_t x, const std::uint32_t Seed 
+
+    ) {
+
+        auto Reverse = []( std::uint32_t v ) {
+
+            v = ( ( v >> 1 ) & 0x55555555 ) | ( ( v & 0x55555555 ) << 1 );
+            v = ( ( v >> 2 ) & 0x33333333 ) | ( ( v & 0x33333333 ) << 2 );
+            v = ( ( v >> 4 ) & 0x0F0F0F0F ) | ( ( v & 0x0F0F0F0F ) << 4 );
+            v = ( ( v >> 8 ) & 0x00FF00FF ) | ( ( v & 0x00FF00FF ) << 8 );
+
+            return ( v >> 16 ) | ( v << 16 );
+
+        };
+
+        x  = Reverse ( x );
+
+        x += Seed;
+        x ^= x * 0x6c50b47c;
+        x ^= x * 0xb82f1e52;
+        x ^= x * 0xc7afe638;
+        x ^= x * 0x8d22f6e6;
+
+        return Reverse ( x );
+
+    }
+
+
+    template < typename Z >
+    Vector<std::uint32_t> SobolBits ( 
+
+        const Z nPoints, 
+        const Z Dim, 
+        const std::uint64_t First 
+
+    ) {
+
+        if ( nPoints < 1 ) {
+
+            throw std::runtime_error (
+                "Sobol: Number of points must be positive integer"
+            );
+
+        }
+
+        if ( Dim < 1 || Dim > 21 ) {
+
+            throw std::runtime_error (
+                "Sobol: dimension must be between 1 and 21"
+            );
+
+        }
+
+        if ( First + nPoints - 1 > 0xFFFFFFFF ) {
+
+            throw std::runtime_error (
+                "Sobol: point index exceeds 32-bit sequence"
+            );
+
+        }
+
+        auto V = SobolDirections<Z> ( Dim );
+
+        Vector<std::uint32_t> x ( Dim, 0 );
+
+        // start of chunk from the Gray code of its index 
+        std::uint64_t Gray = First ^ ( First >> 1 );
+
+        for ( auto k = 0; k < 32; k++ ) {
+
+            if ( !( ( Gray >> k ) & 1 ) ) continue;
+
+            for ( auto j = 0; j < Dim; j++ ) x[j] ^= V[32*j+k];
+
+        }
+
+        Vector<std::uint32_t> result ( nPoints * Dim );
+
+        for ( Z i = 0; i < nPoints; i++ ) {
+
+            std::copy ( x.begin(), x.end(), result.begin() + i * Dim );
+
+            // Antonov-Saleev update, flip the lowest zero bit of the index 
+            std::uint64_t Index = First + i;
+
+            auto k = 0;
+
+            while ( ( Index >> k ) & 1 ) k++;
+
+            if ( k < 32 ) {
+
+                for ( auto j = 0; j < Dim; j++ ) x[j] ^= V[32*j+k];
+
+            }
+
+        }
+
+        return result;
+
+    }
+
+} // MonteCarlo : QMC SubFunctions 
+
+
+namespace MonteCarlo {
+
+    template < typename Z, typename R >
+    Vector<R> Sobol ( const Z nPoints, const Z Dim, const Z FirstPoint ) {
+
+        // index 0 is the origin, skipped 
+        auto Bits = SobolBits<Z> ( nPoints, Dim, std::uint64_t ( FirstPoint ) + 1 );
+
+        const R Scale = R ( 1.0 / 4294967296.0 );
+
+        Vector<R> result ( Bits.size() );
+
+        for ( auto i = 0; i < Bits.size(); i++ ) result[i] = Scale * R ( Bits[i] );
+
+        return result;
+
+    }
+
+} // MonteCarlo : Sobol 
+
+
+namespace MonteCarlo {
+
+    template < typename Z, typename R >
+    Vector<R> ScrambledSobol ( 
+
+        const Z nPoints, 
+        const Z Dim, 
+        const std::uint64_t Seed, 
+        const Z FirstPoint 
+
+    ) {
+
+        auto Bits = SobolBits<Z> ( nPoints, Dim, FirstPoint );
+
+        Philox generator ( Seed );
+
+        Vector<std::uint32_t> Keys ( Dim );
+
+        for ( auto j = 0; j < Dim; j++ ) Keys[j] = generator.Block ( j )[0];
+
+        const R Scale = R ( 1.0 / 4294967296.0 );
+
+        Vector<R> result ( Bits.size() );
+
+        for ( Z i = 0; i < nPoints; i++ ) {
+        for ( auto j = 0; j < Dim; j++ ) {
+
+            auto x = NestedUniformScramble ( Bits[i*Dim+j], Keys[j] );
+
+            // centre of the scrambled cell 
+            result[i*Dim+j] = Scale * ( R ( x ) + R(0.5) );
+
+        }
+        }
+
+        return result;
+
+    }
+
+} // MonteCarlo : ScrambledSobol 
+
+
+namespace MonteCarlo {
+
+    template < typename Z, typename R >
+    Vector<R> ScrambledHalton ( 
+
+        const Z nPoints, 
+        const Z Dim, 
+        const std::uint64_t Seed, 
+        const Z FirstPoint 
+
+    ) {
+
+        if ( nPoints < 1 ) {
+
+            throw std::runtime_error (
+                "Halton: Number of points must be positive integer"
+            );
+
+        }
+
+        if ( Dim < 1 ) {
+
+            throw std::runtime_error (
+                "Halton: dimension must be positive integer"
+            );
+
+        }
+
+        Vector<R> result ( nPoints * Dim );
+
+        Vector<Z> Permutations;
+
+        Z Base = 1;
+
+        for ( auto j = 0; j < Dim; j++ ) {
+
+            // next prime 
+            bool Prime = false;
+
+            while ( !Prime ) {
+
+                Base++;
+                Prime = true;
+
+                for ( Z f = 2; f * f <= Base; f++ ) {
+                    if ( Base % f == 0 ) { Prime = false; break; }
+                }
+
+            }
+
+            // digits down to double resolution 
+            Z nDigits = std::ceil ( 52.0 / std::log2 ( R ( Base ) ) );
+
+            // one Fisher-Yates permutation per digit position 
+            Philox shuffler ( Seed, j );
+
+            Permutations.resize ( nDigits * Base );
+
+            for ( Z k = 0; k < nDigits; k++ ) {
+
+                Z* Perm = Permutations.data() + k * Base;
+
+                std::iota ( Perm, Perm + Base, 0 );
+
+                for ( Z m = Base - 1; m > 0; m-- ) {
+
+                    std::uint64_t Word = std::uint64_t ( shuffler() ) << 32;
+                    Word |= shuffler();
+
+                    std::swap ( Perm[m], Perm[Word%(m+1)] );
+
+                }
+
+            }
+
+            for ( Z i = 0; i < nPoints; i++ ) {
+
+                Z Index = FirstPoint + i;
+
+                R Weight = 1.0 / R ( Base );
+                R Value  = 0.0;
+
+                // leading zeros of the index are permuted as well 
+                for ( Z k = 0; k < nDigits; k++ ) {
+
+                    Value  += Weight * R ( Permutations[k*Base+Index%Base] );
+                    Weight /= R ( Base );
+                    Index  /= Base;
+
+                }
+
+                result[i*Dim+j] = Value + R ( 0.5 * Base ) * Weight;
+
+            }
+
+        }
+
+        return result;
+
+    }
+
+} // MonteCarlo : ScrambledHalton 
+
+
+#endif // QUASI_MONTE_CARLO_IMPLEMENTATIONS 
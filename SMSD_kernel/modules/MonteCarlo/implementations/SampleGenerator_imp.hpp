@@ -0,0 +1,88 @@
+/**
+  * @file SampleGenerator_imp.hpp 
+  *
+  * @brief 
+  * Implementations of chunked generator of standard normal points 
+  * 
+  * @anchor _SampleGenerator_imp_hpp_ 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#ifndef SAMPLE_GENERATOR_IMPLEMENTATIONS 
+#define SAMPLE_GENERATOR_IMPLEMENTATIONS 
+
+#ifndef MONTE_CARLO_DECLARATIONS 
+    #include "MonteCarlo.hpp" 
+#endif 
+
+
+namespace MonteCarlo {
+
+    template < typename Z, typename R >
+    SampleGenerator<Z,R>::SampleGenerator ( 
+
+        const Z Dim, 
+        const std::uint64_t Seed, 
+        const MatrixXT<R>& Correl, 
+        const bool QuasiRandom 
+
+    ) : 
+        Dim_ ( Dim ), Seed_ ( Seed ), QuasiRandom_ ( QuasiRandom ), 
+        Position_ ( 0 ), Correlation_ ( Correl ) {
+
+        if ( Dim < 1 ) {
+
+            throw std::runtime_error (
+                "SampleGenerator: dimension must be positive integer"
+            );
+
+        }
+
+        if ( QuasiRandom && Dim > 21 ) {
+
+            throw std::runtime_error (
+                "SampleGenerator: quasi-random points support up to 21 dimensions"
+            );
+
+        }
+
+        if ( Correl.size() > 0 && Correl.rows() != Dim ) {
+
+            throw std::runtime_error (
+                "SampleGenerator: correlation matrix must be Dim x Dim"
+            );
+
+        }
+
+    } // Constructor 
+
+
+    template < typename Z, typename R >
+    void SampleGenerator<Z,R>::Next ( R* Buffer, const Z nPoints ) {
+
+        if ( nPoints == 0 ) return;
+
+        if ( QuasiRandom_ ) {
+
+            auto Points = ScrambledSobol<Z,R> ( nPoints, Dim_, Seed_, Position_ );
+
+            InverseNormalCDF<Z,R> ( Points.data(), Points.size(), Buffer );
+
+        } else {
+
+            FillNormal<Z,R,R> ( Seed_, Position_ * Dim_, nPoints * Dim_, Buffer );
+
+        }
+
+        Correlation_.Correlate ( Buffer, nPoints );
+
+        Position_ += nPoints;
+
+    } // Next 
+
+} // MonteCarlo : SampleGenerator 
+
+#endif // SAMPLE_GENERATOR_IMPLEMENTATIONS 
@@ -0,0 +1,448 @@
+/**
+  * @file StreamingStatistics_imp.hpp 
+  *
+  * @brief 
+  * Implementations of online statistics of Monte Carlo responses 
+  *
+  * @anchor _StreamingStatistics_imp_hpp_ 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#ifndef STREAMING_STATISTICS_IMPLEMENTATIONS 
+#define STREAMING_STATISTICS_IMPLEMENTATIONS 
+
+#ifndef MONTE_CARLO_DECLARATIONS 
+    #include "MonteCarlo.hpp" 
+#endif 
+
+
+namespace MonteCarlo {
+
+    template < typename Z, typename R, typename C >
+    StreamingStatistics<Z,R,C>::StreamingStatistics (
+
+        const Z nDOFs,
+        const Vector<R>& Probabilities,
+        const Z nBins,
+        const R Lower,
+        const R Upper
+
+    ) :
+        nDOFs_ ( nDOFs ), Count_ ( 0 ),
+        Mean_ ( nDOFs, 0.0 ), M2_ ( nDOFs, 0.0 ),
+        Min_ ( nDOFs, 0.0 ), Max_ ( nDOFs, 0.0 ),
+        nBins_ ( nBins ), Lower_ ( Lower ), Upper_ ( Upper ),
+        Histogram_ ( nDOFs * nBins, 0 ),
+        Probabilities_ ( Probabilities ),
+        Heights_   ( 5 * nDOFs * Probabilities.size(), 0.0 ),
+        Positions_ ( 5 * nDOFs * Probabilities.size(), 0.0 ),
+        Desired_   ( 5 * nDOFs * Probabilities.size(), 0.0 ) {
+
+        if ( nBins > 0 && !( Lower < Upper ) ) {
+
+            throw std::runtime_error (
+                "StreamingStatistics: histogram lower edge must be below upper"
+            );
+
+        }
+
+        for ( auto p : Probabilities ) {
+
+            if ( p <= 0.0 || p >= 1.0 ) {
+
+                throw std::runtime_error (
+                    "StreamingStatistics: probabilities must be in (0,1)"
+                );
+
+            }
+
+        }
+
+    } // Constructor 
+
+
+    template < typename Z, typename R, typename C >
+    void StreamingStatistics<Z,R,C>::Add ( const Vector<C>& Responses ) {
+
+        if ( nDOFs_ == 0 || Responses.size() % nDOFs_ != 0 ) {
+
+            throw std::runtime_error (
+                "StreamingStatistics: num of responses not multiple of DOFs"
+            );
+
+        }
+
+        Add ( Responses.data(), Responses.size() / nDOFs_ );
+
+    } // Add 
+
+
+    template < typename Z, typename R, typename C >
+    void StreamingStatistics<Z,R,C>::Add ( const C* Responses, const Z nPoints ) {
+
+        if ( nPoints == 0 ) return;
+
+        auto nProbs = Probabilities_.size();
+
+        for ( Z j = 0; j < nDOFs_; j++ ) {
+
+            // ================================================================= 
+            // Chunk moments by two passes, then pairwise combination 
+            // ================================================================= 
+
+            C ChunkMean = 0.0;
+
+            for ( Z i = 0; i < nPoints; i++ ) {
+
+                ChunkMean += Responses[i*nDOFs_+j];
+
+            }
+
+            ChunkMean /= R(nPoints);
+
+            R ChunkM2 = 0.0;
+
+            for ( Z i = 0; i < nPoints; i++ ) {
+
+                ChunkM2 += std::norm ( Responses[i*nDOFs_+j] - ChunkMean );
+
+            }
+
+            R nA = Count_;
+            R nB = nPoints;
+            R n  = nA + nB;
+
+            C Delta = ChunkMean - Mean_[j];
+
+            Mean_[j] += Delta * ( nB / n );
+            M2_  [j] += ChunkM2 + std::norm ( Delta ) * nA * nB / n;
+
+
+            // ================================================================= 
+            // Extremes, histogram and quantiles of magnitudes 
+            // ================================================================= 
+
+            for ( Z i = 0; i < nPoints; i++ ) {
+
+                R x = std::abs ( Responses[i*nDOFs_+j] );
+
+                if ( Count_ + i == 0 ) {
+
+                    Min_[j] = x;
+                    Max_[j] = x;
+
+                } else {
+
+                    Min_[j] = std::min ( Min_[j], x );
+                    Max_[j] = std::max ( Max_[j], x );
+
+                }
+
+                if ( nBins_ > 0 ) {
+
+                    R Width = ( Upper_ - Lower_ ) / R(nBins_);
+
+                    Z Bin = x < Lower_ ? 0 :
+                        std::min ( Z ( ( x - Lower_ ) / Width ), nBins_ - 1 );
+
+                    Histogram_[j*nBins_+Bin]++;
+
+                }
+
+                for ( Z p = 0; p < nProbs; p++ ) {
+
+                    AddQuantile ( j * nProbs + p, x, Count_ + i );
+
+                }
+
+            }
+
+        }
+
+        Count_ += nPoints;
+
+    } // Add 
+
+
+    template < typename Z, typename R, typename C >
+    void StreamingStatistics<Z,R,C>::Merge ( const StreamingStatistics& Other ) {
+
+        if (
+            Other.nDOFs_ != nDOFs_ ||
+            Other.nBins_ != nBins_ ||
+            Other.Probabilities_ != Probabilities_
+        ) {
+
+            throw std::runtime_error (
+                "StreamingStatistics: cannot merge different configurations"
+            );
+
+        }
+
+        if ( Other.Count_ == 0 ) return;
+
+        if ( Count_ == 0 ) {
+
+            *this = Other;
+            return;
+
+        }
+
+        R nA = Count_;
+        R nB = Other.Count_;
+        R n  = nA + nB;
+
+        for ( Z j = 0; j < nDOFs_; j++ ) {
+
+            C Delta = Other.Mean_[j] - Mean_[j];
+
+            Mean_[j] += Delta * ( nB / n );
+            M2_  [j] += Other.M2_[j] + std::norm ( Delta ) * nA * nB / n;
+
+            Min_[j] = std::min ( Min_[j], Other.Min_[j] );
+            Max_[j] = std::max ( Max_[j], Other.Max_[j] );
+
+        }
+
+        for ( auto i = 0; i < Histogram_.size(); i++ ) {
+
+            Histogram_[i] += Other.Histogram_[i];
+
+        }
+
+        auto nSets = nDOFs_ * Probabilities_.size();
+
+        if ( Other.Count_ < 5 || Count_ < 5 ) {
+
+            // replay the raw observations of the smaller accumulator 
+            const StreamingStatistics& Small = Count_ < 5 ? *this : Other;
+            const StreamingStatistics& Large = Count_ < 5 ? Other : *this;
+
+            auto nSmall = Small.Count_;
+            auto nLarge = Large.Count_;
+
+            Vector<R> Raw ( Small.Heights_ );
+
+            Heights_   = Large.Heights_;
+            Positions_ = Large.Positions_;
+            Desired_   = Large.Desired_;
+
+            for ( Z s = 0; s < nSets; s++ ) {
+            for ( Z i = 0; i < nSmall; i++ ) {
+
+                AddQuantile ( s, Raw[5*s+i], nLarge + i );
+
+            }
+            }
+
+        } else {
+
+            // both running P^2, ranks add and heights are count-weighted 
+            for ( Z s = 0; s < nSets; s++ ) {
+
+                R p = Probabilities_[s%Probabilities_.size()];
+
+                R* q   = Heights_.data()   + 5 * s;
+                R* pos = Positions_.data() + 5 * s;
+                R* des = Desired_.data()   + 5 * s;
+
+                const R* qB   = Other.Heights_.data()   + 5 * s;
+                const R* posB = Other.Positions_.data() + 5 * s;
+
+                q[0] = std::min ( q[0], qB[0] );
+                q[4] = std::max ( q[4], qB[4] );
+
+                for ( auto i = 1; i < 4; i++ ) {
+
+                    q  [i] = ( nA * q[i] + nB * qB[i] ) / n;
+                    pos[i] = pos[i] + posB[i];
+
+                }
+
+                pos[0] = 1.0;
+                pos[4] = n;
+
+                des[0] = 1.0;
+                des[1] = 1.0 + ( n - 1.0 ) * p / 2.0;
+                des[2] = 1.0 + ( n - 1.0 ) * p;
+                des[3] = 1.0 + ( n - 1.0 ) * ( 1.0 + p ) / 2.0;
+                des[4] = n;
+
+            }
+
+        }
+
+        Count_ += Other.Count_;
+
+    } // Merge 
+
+
+    template < typename Z, typename R, typename C >
+    Vector<R> StreamingStatistics<Z,R,C>::Variance () const {
+
+        Vector<R> result ( nDOFs_, 0.0 );
+
+        if ( Count_ < 2 ) return result;
+
+        for ( Z j = 0; j < nDOFs_; j++ ) {
+
+            result[j] = M2_[j] / R( Count_ - 1 );
+
+        }
+
+        return result;
+
+    } // Variance 
+
+
+    template < typename Z, typename R, typename C >
+    Vector<R> StreamingStatistics<Z,R,C>::Quantiles () const {
+
+        auto nSets = nDOFs_ * Probabilities_.size();
+
+        Vector<R> result ( nSets );
+
+        if ( nSets > 0 && Count_ == 0 ) {
+
+            throw std::runtime_error (
+                "StreamingStatistics: no samples to estimate quantiles"
+            );
+
+        }
+
+        for ( Z s = 0; s < nSets; s++ ) {
+
+            if ( Count_ >= 5 ) {
+
+                result[s] = Heights_[5*s+2];
+                continue;
+
+            }
+
+            // few samples, nearest rank of the raw observations 
+            Vector<R> Raw (
+                Heights_.begin() + 5 * s, Heights_.begin() + 5 * s + Count_
+            );
+
+            std::sort ( Raw.begin(), Raw.end() );
+
+            R p = Probabilities_[s%Probabilities_.size()];
+
+            result[s] = Raw[ Z ( std::round ( p * ( Count_ - 1 ) ) ) ];
+
+        }
+
+        return result;
+
+    } // Quantiles 
+
+
+    template < typename Z, typename R, typename C >
+    void StreamingStatistics<Z,R,C>::AddQuantile (
+
+        const Z Set, const R x, const Z n
+
+    ) {
+
+        R* q   = Heights_.data()   + 5 * Set;
+        R* pos = Positions_.data() + 5 * Set;
+        R* des = Desired_.data()   + 5 * Set;
+
+        R p = Probabilities_[Set%Probabilities_.size()];
+
+        // first five observations initialize the markers 
+        if ( n < 5 ) {
+
+            q[n] = x;
+
+            if ( n == 4 ) {
+
+                std::sort ( q, q + 5 );
+
+                for ( auto i = 0; i < 5; i++ ) pos[i] = i + 1;
+
+                des[0] = 1.0;
+                des[1] = 1.0 + 2.0 * p;
+                des[2] = 1.0 + 4.0 * p;
+                des[3] = 3.0 + 2.0 * p;
+                des[4] = 5.0;
+
+            }
+
+            return;
+
+        }
+
+        // cell k with q[k] <= x < q[k+1], extremes are replaced 
+        Z k = 0;
+
+        if ( x < q[0] ) {
+
+            q[0] = x;
+
+        } else if ( x >= q[4] ) {
+
+            q[4] = x;
+            k    = 3;
+
+        } else {
+
+            while ( k < 3 && x >= q[k+1] ) k++;
+
+        }
+
+        for ( auto i = k + 1; i < 5; i++ ) pos[i] += 1.0;
+
+        des[1] += p / 2.0;
+        des[2] += p;
+        des[3] += ( 1.0 + p ) / 2.0;
+        des[4] += 1.0;
+
+        // move middle markers by piecewise-parabolic prediction 
+        for ( auto i = 1; i < 4; i++ ) {
+
+            R d = des[i] - pos[i];
+
+            if (
+                ( d >=  1.0 && pos[i+1] - pos[i] >  1.0 ) ||
+                ( d <= -1.0 && pos[i-1] - pos[i] < -1.0 )
+            ) {
+
+                R sign = d > 0.0 ? 1.0 : -1.0;
+
+                R qp = q[i] + sign / ( pos[i+1] - pos[i-1] ) * (
+
+                    ( pos[i] - pos[i-1] + sign ) *
+                        ( q[i+1] - q[i] ) / ( pos[i+1] - pos[i] ) +
+
+                    ( pos[i+1] - pos[i] - sign ) *
+                        ( q[i] - q[i-1] ) / ( pos[i] - pos[i-1] )
+
+                );
+
+                if ( q[i-1] < qp && qp < q[i+1] ) {
+
+                    q[i] = qp;
+
+                } else {
+
+                    auto j = sign > 0.0 ? i + 1 : i - 1;
+
+                    q[i] += sign * ( q[j] - q[i] ) / ( pos[j] - pos[i] );
+
+                }
+
+                pos[i] += sign;
+
+            }
+
+        }
+
+    } // AddQuantile 
+
+} // MonteCarlo : StreamingStatistics 
+
+#endif // STREAMING_STATISTICS_IMPLEMENTATIONS 
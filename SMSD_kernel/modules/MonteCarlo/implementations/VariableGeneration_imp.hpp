@@ -22,22 +22,38 @@
 
 namespace MonteCarlo {
 
-    template < typename Z, typename R >
-    void ConvertLHStoStdNorm ( Vector<R>& LHSResult ) {
-
-        boost::math::normal dist ( R(0.0), R(1.0) );
-
-        std::transform (
-
-            LHSResult.begin(), LHSResult.end(),
-            LHSResult.begin(),
+    template < typename Z, typename R, typename C > 
+    /**
+      * @private 
+      * 
+      * @brief 
+      * Standard normal variables First, First + 1, ... of the Philox 
+      * stream of given seed, written to caller memory 
+      * 
+      * @param Seed       seed of @ref _Philox_ 
+      * @param First      global index of the first variable 
+      * @param nVariables number of variables 
+      * @param Variables  output of size nVariables 
+      */
+    void FillNormal ( 
+
+        const std::uint64_t Seed, 
+        const Z First, 
+        const Z nVariables, 
+        C* Variables 
+
+    );
+
+} // MonteCarlo : VariableGeneration SubFunctions Declarations 
 
-            [&dist]( const auto m ) {
 
-                return quantile ( dist, m );
+namespace MonteCarlo {
 
-            }
+    template < typename Z, typename R >
+    void ConvertLHStoStdNorm ( Vector<R>& LHSResult ) {
 
+        InverseNormalCDF<Z,R> ( 
+            LHSResult.data(), LHSResult.size(), LHSResult.data() 
         );
 
     }
@@ -52,22 +68,69 @@ namespace MonteCarlo {
 
         std::random_device device;
 
-        std::default_random_engine generator ( device() );
+        std::uint64_t Seed = std::uint64_t ( device() ) << 32 | device();
 
-        std::normal_distribution <R> RandomVariable ( 0.0, 1.0 );
+        return RandomSampling<Z,R,C> ( nPoints, dim, Seed );
 
-        Vector<C> result ( nPoints * dim );
+    }
 
-        for ( auto i = 0; i < result.size(); i++ ) {
 
-            result[i] = C(RandomVariable(generator));
+    template < typename Z, typename R, typename C > 
+    Vector<C> RandomSampling ( 
 
-        }
+        const Z nPoints, 
+        const Z dim, 
+        const std::uint64_t Seed, 
+        const Z FirstPoint 
+
+    ) {
+
+        Vector<C> result ( nPoints * dim );
+
+        FillNormal<Z,R,C> ( Seed, FirstPoint * dim, result.size(), result.data() );
 
         return result;
 
     }
 
+
+    template < typename Z, typename R, typename C > 
+    void FillNormal ( 
+
+        const std::uint64_t Seed, 
+        const Z First, 
+        const Z nVariables, 
+        C* Variables 
+
+    ) {
+
+        const R TwoPi = 2.0 * boost::math::constants::pi<R>();
+
+        Philox generator ( Seed );
+
+        // Box-Muller, block b gives global variables 2b and 2b+1 
+        for ( Z e = First - First % 2; e < First + nVariables; e += 2 ) {
+
+            auto Words = generator.Block ( e / 2 );
+
+            R Radius = std::sqrt ( 
+                -2.0 * std::log ( Philox::Uniform<R> ( Words[0], Words[1] ) ) 
+            );
+
+            R Angle = TwoPi * Philox::Uniform<R> ( Words[2], Words[3] );
+
+            if ( e >= First ) {
+                Variables[e-First] = C ( Radius * std::cos ( Angle ) );
+            }
+
+            if ( e + 1 < First + nVariables ) {
+                Variables[e+1-First] = C ( Radius * std::sin ( Angle ) );
+            }
+
+        }
+
+    }
+
 }
 
 
@@ -82,19 +145,13 @@ namespace MonteCarlo {
 
     ) {
 
-        // obtain lower triangular from cholesky decomp.
-        MatrixXT<R> L = Correl.llt().matrixL();
+        Vector<R> Correlated ( RVs );
 
-        // wrap RVs vector to perform multiplication
-        Eigen::Map<MatrixXT<R>> RVMap ( RVs.data(), dim, RVs.size()/dim );
-
-        // create result vector and wrap to receive multiplication result 
-        Vector<C> result ( RVs.size() );
-        Eigen::Map<MatrixXT<C>> MResult ( result.data(), dim, RVs.size()/dim);
+        CorrelatedSampler<size_t,R> ( Correl ).Correlate ( 
+            Correlated.data(), RVs.size() / dim 
+        );
 
-        MResult = L * RVMap;
-
-        return result;
+        return Vector<C> ( Correlated.begin(), Correlated.end() );
 
     }
 
@@ -113,35 +170,13 @@ namespace MonteCarlo {
 
     ) {
 
-        // obtain lower triangular from cholesky decomp.
-        MatrixXT<R> L = Correl.llt().matrixL();
+        // for repeated calls keep a CorrelatedSampler instead 
+        Vector<R> result ( StdNormRVs );
 
-        // wrap RVs vector to perform multiplication
-        Eigen::Map<MatrixXT<R>> RVMap ( 
-            StdNormRVs.data(), dim, StdNormRVs.size()/dim 
+        CorrelatedSampler<Z,R> ( Correl ).Transform ( 
+            result.data(), result.size() / dim, ICDFs 
         );
 
-        auto CorrelatedStdNorm = L * RVMap;
-
-
-        Vector<R> result ( StdNormRVs.size(), 0.0 );
-
-
-        boost::math::normal dist ( R(0.0), R(1.0) );
-
-        auto CDF = [dist](const auto m){
-            return boost::math::cdf ( dist, m );
-        };
-
-
-        for ( auto i = 0; i < CorrelatedStdNorm.rows(); i++ ) {
-        for ( auto j = 0; j < CorrelatedStdNorm.cols(); j++ ) {
-
-            result[i+j*dim] = ICDFs[i] ( CDF ( CorrelatedStdNorm(i,j) ) );
-
-        }
-        }
-
         return result; 
 
     }
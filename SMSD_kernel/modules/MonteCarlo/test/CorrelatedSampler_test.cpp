@@ -0,0 +1,116 @@
+/**
+  * @file CorrelatedSampler_test.cpp
+  *
+  * @brief 
+  * Tests of reusable correlated random variable transformation 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#include "MonteCarlo.hpp" 
+#include <gtest/gtest.h> 
+
+typedef MonteCarlo::CorrelatedSampler<size_t,double> Sampler;
+
+TEST ( CorrelatedSampler, CorrelateMatchCholeskyProduct ) {
+
+    size_t dim     = 4;
+    size_t nPoints = 50;
+
+    Eigen::MatrixXd A = Eigen::MatrixXd::Random ( dim, dim );
+    Eigen::MatrixXd Correl = A * A.transpose() + dim * Eigen::MatrixXd::Identity ( dim, dim );
+
+    auto Points = MonteCarlo::RandomSampling<size_t,double,double> ( nPoints, dim, 4 );
+
+    Eigen::MatrixXd Expected = Correl.llt().matrixL() * 
+        Eigen::Map<Eigen::MatrixXd> ( Points.data(), dim, nPoints );
+
+    Sampler ( Correl ).Correlate ( Points.data(), nPoints );
+
+    for ( auto p = 0; p < nPoints; p++ ) {
+    for ( auto i = 0; i < dim; i++ ) {
+
+        EXPECT_NEAR ( Points[p*dim+i], Expected(i,p), 1e-12 );
+
+    }
+    }
+
+}
+
+
+TEST ( CorrelatedSampler, FunctorsMatchStdFunctions ) {
+
+    size_t dim     = 2;
+    size_t nPoints = 100;
+
+    Eigen::MatrixXd Correl ( 2, 2 );
+    Correl << 1.0, 0.3, 0.3, 1.0;
+
+    boost::math::lognormal Stiffness ( 0.0, 0.1 );
+    boost::math::uniform   Mass ( 1.0, 2.0 );
+
+    auto StiffnessICDF = [&Stiffness]( double u ) { return quantile ( Stiffness, u ); };
+    auto MassICDF      = [&Mass]( double u ) { return quantile ( Mass, u ); };
+
+    auto Inlined = MonteCarlo::RandomSampling<size_t,double,double> ( nPoints, dim, 6 );
+    auto Erased  = Inlined;
+    auto Legacy  = Inlined;
+
+    Sampler Transformer ( Correl );
+
+    Transformer.Transform ( Inlined.data(), nPoints, StiffnessICDF, MassICDF );
+
+    std::vector< std::function<double(double)> > ICDFs { StiffnessICDF, MassICDF };
+
+    Transformer.Transform ( Erased.data(), nPoints, ICDFs );
+
+    auto Generated = MonteCarlo::GenerateRVs<size_t,double> ( Legacy, Correl, ICDFs, dim );
+
+    EXPECT_EQ ( Inlined, Erased );
+    EXPECT_EQ ( Inlined, Generated );
+
+    for ( auto p = 0; p < nPoints; p++ ) {
+
+        EXPECT_GT ( Inlined[p*dim+1], 1.0 );
+        EXPECT_LT ( Inlined[p*dim+1], 2.0 );
+
+    }
+
+}
+
+
+TEST ( CorrelatedSampler, EmptyMatrixIsIndependent ) {
+
+    std::vector<double> Points { 1.0, 2.0, 3.0 };
+
+    Eigen::MatrixXd Empty;
+
+    Sampler Independent ( Empty );
+
+    Independent.Correlate ( Points.data(), 3 );
+
+    EXPECT_EQ ( Independent.Dim(), 0 );
+    EXPECT_EQ ( Points, std::vector<double> ( { 1.0, 2.0, 3.0 } ) );
+
+}
+
+
+TEST ( CorrelatedSampler, InvalidInputs ) {
+
+    Eigen::MatrixXd Indefinite ( 2, 2 );
+    Indefinite << 1.0, 2.0, 2.0, 1.0;
+
+    EXPECT_THROW ( Sampler Bad ( Indefinite ), std::runtime_error );
+    EXPECT_THROW ( Sampler Bad ( Eigen::MatrixXd ( 2, 3 ) ), std::runtime_error );
+
+    Sampler Transformer ( Eigen::MatrixXd::Identity ( 2, 2 ) );
+
+    std::vector<double> Points ( 2 );
+
+    auto Identity = []( double u ) { return u; };
+
+    EXPECT_THROW ( Transformer.Transform ( Points.data(), 1, Identity ), std::runtime_error );
+
+}
@@ -577,3 +577,113 @@ TEST ( LatinHypercubeSampling, MultipleIntervalsMultipleSamples ) {
 }
 
 
+
+
+TEST ( LatinHypercubeSampling, PointMajorMatchSortedUnsorted ) {
+
+    for ( size_t nPoints : { 1, 2, 7, 1000 } ) {
+    for ( size_t dim     : { 1, 3 } ) {
+
+        auto Direct = MonteCarlo::LHS<size_t,double> ( nPoints, dim, 99 );
+
+        auto Sorted = MonteCarlo::SortLHS<size_t,double> ( 
+            MonteCarlo::UnsortedLHS<size_t,double> ( nPoints, dim, 99 ), 
+            MonteCarlo::TransposerIndices<size_t> ( nPoints, dim ) 
+        );
+
+        EXPECT_EQ ( Direct, Sorted );
+
+    }
+    }
+
+}
+
+
+/**
+  * @brief 
+  * Smallest pairwise distance of a point-major design 
+  */
+double MinDistance ( const std::vector<double>& Points, const size_t dim ) {
+
+    double result = 1e300;
+
+    size_t nPoints = Points.size() / dim;
+
+    for ( auto i = 0; i < nPoints; i++ ) {
+    for ( auto j = i + 1; j < nPoints; j++ ) {
+
+        double d2 = 0.0;
+
+        for ( auto k = 0; k < dim; k++ ) {
+
+            double dx = Points[i*dim+k] - Points[j*dim+k];
+
+            d2 += dx * dx;
+
+        }
+
+        result = std::min ( result, std::sqrt ( d2 ) );
+
+    }
+    }
+
+    return result;
+
+}
+
+
+TEST ( OptimizedLHS, RemainsLatinHypercube ) {
+
+    size_t nPoints = 200;
+    size_t dim     = 3;
+
+    auto result = MonteCarlo::OptimizedLHS<size_t,double> ( nPoints, dim, 17 );
+
+    ASSERT_EQ ( result.size(), nPoints * dim );
+
+    for ( auto k = 0; k < dim; k++ ) {
+
+        std::vector<int> Intervals ( nPoints, 0 );
+
+        for ( auto i = 0; i < nPoints; i++ ) {
+
+            Intervals [ size_t ( result[i*dim+k] * nPoints ) ]++;
+
+        }
+
+        for ( auto Count : Intervals ) EXPECT_EQ ( Count, 1 );
+
+    }
+
+    auto Again = MonteCarlo::OptimizedLHS<size_t,double> ( nPoints, dim, 17 );
+
+    EXPECT_EQ ( result, Again );
+
+}
+
+
+TEST ( OptimizedLHS, ImprovesSpaceFilling ) {
+
+    size_t nPoints = 100;
+    size_t dim     = 2;
+
+    // same seed gives the starting design 
+    auto Initial   = MonteCarlo::LHS<size_t,double> ( nPoints, dim, 5 );
+    auto Optimized = MonteCarlo::OptimizedLHS<size_t,double> ( nPoints, dim, 5 );
+
+    // random designs typically have a much smaller minimum distance 
+    EXPECT_GT ( MinDistance ( Optimized, dim ), 2.0 * MinDistance ( Initial, dim ) );
+
+    EXPECT_GT ( MinDistance ( Optimized, dim ), 0.5 / nPoints * std::sqrt ( nPoints ) );
+
+}
+
+
+TEST ( OptimizedLHS, WrongExponent ) {
+
+    EXPECT_THROW ( 
+        ( MonteCarlo::OptimizedLHS<size_t,double> ( 10, 2, 1, 100, 0 ) ), 
+        std::runtime_error 
+    );
+
+}
@@ -0,0 +1,151 @@
+/**
+  * @file Nataf_test.cpp
+  *
+  * @brief 
+  * Tests of Nataf transformation with fictive correlation 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#include "MonteCarlo.hpp" 
+#include <gtest/gtest.h> 
+
+typedef MonteCarlo::NatafTransformation<size_t,double> Nataf;
+typedef std::vector< std::function<double(double)> > Functions;
+
+TEST ( NatafTransformation, ClosedFormFictiveCorrelations ) {
+
+    const double Pi = boost::math::constants::pi<double>();
+
+    boost::math::normal    Gauss ( 2.0, 3.0 );
+    boost::math::lognormal Stiffness ( 0.0, 0.5 );
+    boost::math::lognormal Mass ( 1.0, 0.3 );
+    boost::math::uniform   Damping ( 0.0, 1.0 );
+    boost::math::uniform   Other ( -1.0, 3.0 );
+
+    Eigen::MatrixXd Correl ( 5, 5 );
+    Correl << 
+        1.0, 0.0, 0.0, 0.0, 0.0, 
+        0.0, 1.0, 0.6, 0.0, 0.0, 
+        0.0, 0.6, 1.0, 0.0, 0.0, 
+        0.0, 0.0, 0.0, 1.0, 0.5, 
+        0.0, 0.0, 0.0, 0.5, 1.0;
+
+    Functions ICDFs {
+        [&]( double u ) { return quantile ( Gauss, u ); }, 
+        [&]( double u ) { return quantile ( Stiffness, u ); }, 
+        [&]( double u ) { return quantile ( Mass, u ); }, 
+        [&]( double u ) { return quantile ( Damping, u ); }, 
+        [&]( double u ) { return quantile ( Other, u ); } 
+    };
+
+    Nataf Transformation ( Correl, ICDFs );
+
+    auto& Fictive = Transformation.FictiveCorrelation();
+
+    // lognormal pair 
+    double s1 = 0.5, s2 = 0.3;
+
+    double Lognormal = std::log ( 
+        1.0 + 0.6 * std::sqrt ( std::expm1 ( s1 * s1 ) * std::expm1 ( s2 * s2 ) ) 
+    ) / ( s1 * s2 );
+
+    EXPECT_NEAR ( Fictive(1,2), Lognormal, 1e-6 );
+    EXPECT_NEAR ( Fictive(2,1), Lognormal, 1e-6 );
+
+    // uniform pair, rho = 6 / pi * asin ( rho0 / 2 ) 
+    EXPECT_NEAR ( Fictive(3,4), 2.0 * std::sin ( Pi * 0.5 / 6.0 ), 1e-4 );
+
+    EXPECT_EQ ( Fictive(0,1), 0.0 );
+    EXPECT_EQ ( Fictive(0,0), 1.0 );
+
+}
+
+
+TEST ( NatafTransformation, NormalMarginalsKeepCorrelation ) {
+
+    boost::math::normal First ( 0.0, 1.0 ), Second ( 5.0, 0.1 );
+
+    Eigen::MatrixXd Correl ( 2, 2 );
+    Correl << 1.0, -0.8, -0.8, 1.0;
+
+    Functions ICDFs {
+        [&]( double u ) { return quantile ( First, u ); }, 
+        [&]( double u ) { return quantile ( Second, u ); } 
+    };
+
+    Nataf Transformation ( Correl, ICDFs );
+
+    EXPECT_NEAR ( Transformation.FictiveCorrelation()(0,1), -0.8, 1e-10 );
+
+}
+
+
+TEST ( NatafTransformation, SamplesHaveTargetCorrelation ) {
+
+    size_t nPoints = 100000;
+    size_t dim     = 2;
+
+    boost::math::lognormal Stiffness ( 0.0, 0.8 );
+    boost::math::uniform   Mass ( 1.0, 2.0 );
+
+    Eigen::MatrixXd Correl ( 2, 2 );
+    Correl << 1.0, 0.7, 0.7, 1.0;
+
+    auto StiffnessICDF = [&]( double u ) { return quantile ( Stiffness, u ); };
+    auto MassICDF      = [&]( double u ) { return quantile ( Mass, u ); };
+
+    Nataf Transformation ( Correl, { StiffnessICDF, MassICDF } );
+
+    EXPECT_GT ( Transformation.FictiveCorrelation()(0,1), 0.7 );
+
+    auto Points = MonteCarlo::RandomSampling<size_t,double,double> ( nPoints, dim, 2 );
+    auto Inline = Points;
+
+    Transformation.Transform ( Points.data(), nPoints );
+
+    // cached sampler with inline functors gives the same points 
+    Transformation.Sampler().Transform ( Inline.data(), nPoints, StiffnessICDF, MassICDF );
+
+    EXPECT_EQ ( Points, Inline );
+
+    double Mean[2] = { 0.0, 0.0 };
+
+    for ( auto p = 0; p < nPoints; p++ ) {
+        for ( auto j = 0; j < 2; j++ ) Mean[j] += Points[p*dim+j] / nPoints;
+    }
+
+    double Cov = 0.0, Var[2] = { 0.0, 0.0 };
+
+    for ( auto p = 0; p < nPoints; p++ ) {
+
+        double x = Points[p*dim] - Mean[0], y = Points[p*dim+1] - Mean[1];
+
+        Cov    += x * y;
+        Var[0] += x * x;
+        Var[1] += y * y;
+
+    }
+
+    EXPECT_NEAR ( Cov / std::sqrt ( Var[0] * Var[1] ), 0.7, 0.01 );
+
+}
+
+
+TEST ( NatafTransformation, InvalidInputs ) {
+
+    boost::math::lognormal Wide ( 0.0, 1.0 );
+
+    auto ICDF = [&]( double u ) { return quantile ( Wide, u ); };
+
+    Eigen::MatrixXd Correl ( 2, 2 );
+    Correl << 1.0, -0.9, -0.9, 1.0;
+
+    // lognormals with unit log-deviation cannot reach -0.9 
+    EXPECT_THROW ( Nataf Bad ( Correl, { ICDF, ICDF } ), std::runtime_error );
+
+    EXPECT_THROW ( Nataf Bad ( Correl, { ICDF } ), std::runtime_error );
+
+}
@@ -0,0 +1,106 @@
+/**
+  * @file NormalDistribution_test.cpp
+  *
+  * @brief 
+  * Tests of buffer-wide standard normal CDF and its inverse 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#include "MonteCarlo.hpp" 
+#include <gtest/gtest.h> 
+
+TEST ( InverseNormalCDF, AccuracyContractAgainstBoost ) {
+
+    boost::math::normal dist ( 0.0, 1.0 );
+
+    std::vector<double> P;
+
+    // both tails down to 1e-300 and a dense central grid 
+    for ( auto e = -300.0; e < -1.0; e += 0.25 ) {
+
+        P.push_back ( std::pow ( 10.0, e ) );
+        P.push_back ( 1.0 - std::pow ( 10.0, std::max ( e, -16.0 ) ) );
+
+    }
+
+    for ( auto i = 1; i < 10000; i++ ) P.push_back ( i / 10000.0 );
+
+    // boundaries of the central region 
+    P.push_back ( 0.02425 );
+    P.push_back ( 1.0 - 0.02425 );
+
+    std::vector<double> X ( P.size() );
+
+    MonteCarlo::InverseNormalCDF<size_t,double> ( P.data(), P.size(), X.data() );
+
+    for ( auto i = 0; i < P.size(); i++ ) {
+
+        double Expected = boost::math::quantile ( dist, P[i] );
+
+        EXPECT_NEAR ( 
+            X[i], Expected, 1e-14 * std::max ( 1.0, std::abs ( Expected ) ) 
+        ) << "p = " << P[i];
+
+    }
+
+}
+
+
+TEST ( InverseNormalCDF, EdgeValuesAndInPlace ) {
+
+    std::vector<double> P { 0.0, 1.0, -0.5, 1.5, 0.5, 4.9e-324 };
+
+    MonteCarlo::InverseNormalCDF<size_t,double> ( P.data(), P.size(), P.data() );
+
+    EXPECT_EQ ( P[0], -std::numeric_limits<double>::infinity() );
+    EXPECT_EQ ( P[1],  std::numeric_limits<double>::infinity() );
+
+    EXPECT_TRUE ( std::isnan ( P[2] ) );
+    EXPECT_TRUE ( std::isnan ( P[3] ) );
+
+    EXPECT_DOUBLE_EQ ( P[4], 0.0 );
+
+    // denormal probability keeps the unrefined approximation 
+    EXPECT_NEAR ( P[5], -38.4674, 1e-3 );
+
+}
+
+
+TEST ( NormalCDF, MatchBoostAndRoundTrip ) {
+
+    boost::math::normal dist ( 0.0, 1.0 );
+
+    std::vector<double> X;
+
+    for ( auto x = -37.0; x <= 8.0; x += 0.01 ) X.push_back ( x );
+
+    std::vector<double> P ( X.size() );
+
+    MonteCarlo::NormalCDF<size_t,double> ( X.data(), X.size(), P.data() );
+
+    for ( auto i = 0; i < X.size(); i++ ) {
+
+        double Expected = boost::math::cdf ( dist, X[i] );
+
+        // rounding of x / sqrt(2) is amplified by x^2 in the tail 
+        EXPECT_NEAR ( 
+            P[i], Expected, 4e-16 * ( 1.0 + X[i] * X[i] ) * Expected 
+        );
+
+    }
+
+    MonteCarlo::InverseNormalCDF<size_t,double> ( P.data(), P.size(), P.data() );
+
+    // round trip limited by resolution of p near one 
+    for ( auto i = 0; i < X.size(); i++ ) {
+
+        if ( X[i] > 0.0 ) break;
+
+        EXPECT_NEAR ( P[i], X[i], 1e-12 * std::max ( 1.0, std::abs ( X[i] ) ) );
+
+    }
+
+}
@@ -0,0 +1,150 @@
+/**
+  * @file Philox_test.cpp
+  *
+  * @brief 
+  * Tests of counter-based random number generator 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#include "MonteCarlo.hpp" 
+#include <gtest/gtest.h> 
+
+TEST ( Philox, KnownAnswers ) {
+
+    // Random123 known-answer vectors, stream holds counter words 2 and 3 
+
+    MonteCarlo::Philox Zeros ( 0, 0 );
+
+    std::array<std::uint32_t,4> Expected {
+        0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8
+    };
+
+    EXPECT_EQ ( Zeros.Block ( 0 ), Expected );
+
+
+    MonteCarlo::Philox Ones ( ~std::uint64_t(0), ~std::uint64_t(0) );
+
+    Expected = { 0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd };
+
+    EXPECT_EQ ( Ones.Block ( ~std::uint64_t(0) ), Expected );
+
+
+    MonteCarlo::Philox Pi ( 0x299f31d0a4093822, 0x0370734413198a2e );
+
+    Expected = { 0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 };
+
+    EXPECT_EQ ( Pi.Block ( 0x85a308d3243f6a88 ), Expected );
+
+}
+
+
+TEST ( Philox, SeekMatchSequential ) {
+
+    MonteCarlo::Philox Sequential ( 42, 3 );
+
+    std::vector<std::uint32_t> Words ( 40 );
+
+    for ( auto& Word : Words ) Word = Sequential();
+
+    MonteCarlo::Philox Jumper ( 42, 3 );
+
+    Jumper.Seek ( 7 );
+
+    for ( auto i = 28; i < 40; i++ ) EXPECT_EQ ( Jumper(), Words[i] );
+
+    // different stream, different sequence 
+    MonteCarlo::Philox Other ( 42, 4 );
+
+    EXPECT_NE ( Other.Block ( 0 ), Sequential.Block ( 0 ) );
+
+}
+
+
+TEST ( Philox, UniformOpenInterval ) {
+
+    EXPECT_GT ( MonteCarlo::Philox::Uniform<double> ( 0, 0 ), 0.0 );
+    EXPECT_LT ( MonteCarlo::Philox::Uniform<double> ( ~0u, ~0u ), 1.0 );
+
+    EXPECT_DOUBLE_EQ ( 
+        MonteCarlo::Philox::Uniform<double> ( 0x80000000, 0 ), 
+        0.5 + 0.5 / 4503599627370496.0 
+    );
+
+}
+
+
+TEST ( Philox, SeededLHSReproducible ) {
+
+    size_t nPoints = 101;
+    size_t dim     = 3;
+
+    auto First  = MonteCarlo::UnsortedLHS<size_t,double> ( nPoints, dim, 7 );
+    auto Second = MonteCarlo::UnsortedLHS<size_t,double> ( nPoints, dim, 7 );
+    auto Third  = MonteCarlo::UnsortedLHS<size_t,double> ( nPoints, dim, 8 );
+
+    EXPECT_EQ ( First, Second );
+    EXPECT_NE ( First, Third );
+
+    // still one point per interval 
+    for ( auto j = 0; j < dim; j++ ) {
+
+        std::vector<bool> indices ( nPoints, false );
+
+        for ( auto i = 0; i < nPoints; i++ ) {
+
+            indices [ size_t ( First[j*nPoints+i] * nPoints ) ] = true;
+
+        }
+
+        for ( auto i = 0; i < nPoints; i++ ) EXPECT_TRUE ( indices[i] );
+
+    }
+
+}
+
+
+TEST ( Philox, SeededRandomSamplingChunks ) {
+
+    typedef std::complex<double> Complex;
+
+    size_t nPoints = 1001;
+    size_t dim     = 3;
+
+    auto Whole = MonteCarlo::RandomSampling<size_t,double,Complex> ( 
+        nPoints, dim, 11 
+    );
+
+    // odd chunk boundaries split Box-Muller pairs 
+    for ( size_t First : { 0, 1, 500, 999 } ) {
+
+        auto Chunk = MonteCarlo::RandomSampling<size_t,double,Complex> ( 
+            2, dim, 11, First 
+        );
+
+        for ( auto i = 0; i < 2 * dim; i++ ) {
+
+            EXPECT_EQ ( Chunk[i], Whole[First*dim+i] );
+
+        }
+
+    }
+
+    double Mean = 0.0, Square = 0.0;
+
+    for ( auto& x : Whole ) {
+
+        Mean   += x.real();
+        Square += x.real() * x.real();
+
+    }
+
+    Mean   /= Whole.size();
+    Square /= Whole.size();
+
+    EXPECT_NEAR ( Mean,   0.0, 0.1 );
+    EXPECT_NEAR ( Square, 1.0, 0.1 );
+
+}
@@ -0,0 +1,182 @@
+/**
+  * @file QuasiMonteCarlo_test.cpp
+  *
+  * @brief 
+  * Tests of low-discrepancy sample generators 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#include "MonteCarlo.hpp" 
+#include <boost/random/sobol.hpp> 
+#include <gtest/gtest.h> 
+
+TEST ( Sobol, MatchBoostJoeKuo ) {
+
+    size_t nPoints = 4096;
+    size_t dim     = 21;
+
+    auto result = MonteCarlo::Sobol<size_t,double> ( nPoints, dim );
+
+    ASSERT_EQ ( result.size(), nPoints * dim );
+
+    // boost also skips the origin, 64-bit words 
+    boost::random::sobol Reference ( dim );
+
+    for ( auto i = 0; i < nPoints * dim; i++ ) {
+
+        double Expected = ( Reference() >> 32 ) / 4294967296.0;
+
+        ASSERT_EQ ( result[i], Expected ) << "point " << i / dim;
+
+    }
+
+}
+
+
+TEST ( Sobol, ChunksMatchSingleCall ) {
+
+    size_t dim = 5;
+
+    auto Whole     = MonteCarlo::Sobol<size_t,double> ( 1000, dim );
+    auto Scrambled = MonteCarlo::ScrambledSobol<size_t,double> ( 1000, dim, 3 );
+    auto Halton    = MonteCarlo::ScrambledHalton<size_t,double> ( 1000, dim, 3 );
+
+    for ( size_t First : { 1, 255, 256, 777 } ) {
+
+        auto Chunk  = MonteCarlo::Sobol<size_t,double> ( 100, dim, First );
+        auto ChunkS = MonteCarlo::ScrambledSobol<size_t,double> ( 100, dim, 3, First );
+        auto ChunkH = MonteCarlo::ScrambledHalton<size_t,double> ( 100, dim, 3, First );
+
+        for ( auto i = 0; i < 100 * dim && First * dim + i < Whole.size(); i++ ) {
+
+            EXPECT_EQ ( Chunk [i], Whole    [First*dim+i] );
+            EXPECT_EQ ( ChunkS[i], Scrambled[First*dim+i] );
+            EXPECT_EQ ( ChunkH[i], Halton   [First*dim+i] );
+
+        }
+
+    }
+
+}
+
+
+TEST ( ScrambledSobol, KeepsNetProperty ) {
+
+    size_t m       = 10;
+    size_t nPoints = 1 << m;
+    size_t dim     = 3;
+
+    auto result = MonteCarlo::ScrambledSobol<size_t,double> ( nPoints, dim, 12345 );
+
+    for ( auto x : result ) {
+
+        EXPECT_GT ( x, 0.0 );
+        EXPECT_LT ( x, 1.0 );
+
+    }
+
+    // first two dimensions are a ( 0, m, 2 )-net: one point per box 
+    for ( auto a = 0; a <= m; a++ ) {
+
+        std::vector<int> Boxes ( nPoints, 0 );
+
+        for ( auto i = 0; i < nPoints; i++ ) {
+
+            size_t Row = result[i*dim  ] * ( 1 << a );
+            size_t Col = result[i*dim+1] * ( 1 << ( m - a ) );
+
+            Boxes [ Row * ( 1 << ( m - a ) ) + Col ]++;
+
+        }
+
+        for ( auto Count : Boxes ) ASSERT_EQ ( Count, 1 ) << "a = " << a;
+
+    }
+
+    auto Other = MonteCarlo::ScrambledSobol<size_t,double> ( nPoints, dim, 54321 );
+
+    EXPECT_NE ( result, Other );
+
+}
+
+
+TEST ( ScrambledHalton, StratifiedProjections ) {
+
+    size_t dim = 3;
+
+    // first base^k points fill every interval of width base^-k once 
+    for ( size_t Base : { 2, 3, 5 } ) {
+
+        size_t j       = Base == 2 ? 0 : Base == 3 ? 1 : 2;
+        size_t nPoints = Base == 2 ? 1024 : Base == 3 ? 729 : 625;
+
+        auto result = MonteCarlo::ScrambledHalton<size_t,double> ( nPoints, dim, 9 );
+
+        std::vector<int> Intervals ( nPoints, 0 );
+
+        for ( auto i = 0; i < nPoints; i++ ) {
+
+            EXPECT_GT ( result[i*dim+j], 0.0 );
+            EXPECT_LT ( result[i*dim+j], 1.0 );
+
+            Intervals [ size_t ( result[i*dim+j] * nPoints ) ]++;
+
+        }
+
+        for ( auto Count : Intervals ) ASSERT_EQ ( Count, 1 ) << "base " << Base;
+
+    }
+
+}
+
+
+TEST ( QuasiMonteCarlo, IntegrationBeatsRandomSampling ) {
+
+    size_t nPoints = 4096;
+    size_t dim     = 6;
+
+    // integrand with exact mean one 
+    auto Integrate = [dim]( const std::vector<double>& Points ) {
+
+        double Sum = 0.0;
+
+        for ( auto i = 0; i < Points.size(); i += dim ) {
+
+            double f = 1.0;
+
+            for ( auto j = 0; j < dim; j++ ) f *= 1.0 + ( Points[i+j] - 0.5 );
+
+            Sum += f;
+
+        }
+
+        return std::abs ( Sum / ( Points.size() / dim ) - 1.0 );
+
+    };
+
+    EXPECT_LT ( Integrate ( MonteCarlo::Sobol<size_t,double> ( nPoints, dim ) ), 1e-3 );
+    EXPECT_LT ( Integrate ( MonteCarlo::ScrambledSobol<size_t,double> ( nPoints, dim, 1 ) ), 1e-3 );
+    EXPECT_LT ( Integrate ( MonteCarlo::ScrambledHalton<size_t,double> ( nPoints, dim, 1 ) ), 1e-3 );
+
+}
+
+
+TEST ( Sobol, InvalidInputs ) {
+
+    EXPECT_THROW ( ( MonteCarlo::Sobol<size_t,double> ( 0, 2 ) ), std::runtime_error );
+    EXPECT_THROW ( ( MonteCarlo::Sobol<size_t,double> ( 10, 22 ) ), std::runtime_error );
+
+    EXPECT_THROW ( 
+        ( MonteCarlo::Sobol<size_t,double> ( 10, 2, 0xFFFFFFFF ) ), 
+        std::runtime_error 
+    );
+
+    EXPECT_THROW ( 
+        ( MonteCarlo::ScrambledHalton<size_t,double> ( 10, 0, 1 ) ), 
+        std::runtime_error 
+    );
+
+}
@@ -0,0 +1,134 @@
+/**
+  * @file SampleGenerator_test.cpp
+  *
+  * @brief 
+  * Tests of chunked generator of standard normal points 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#include "MonteCarlo.hpp" 
+#include <gtest/gtest.h> 
+
+typedef MonteCarlo::SampleGenerator<size_t,double> Generator;
+
+TEST ( SampleGenerator, ChunksMatchRandomSampling ) {
+
+    size_t dim = 3;
+
+    auto Whole = MonteCarlo::RandomSampling<size_t,double,double> ( 1000, dim, 21 );
+
+    Generator Stream ( dim, 21 );
+
+    std::vector<double> Buffer ( 1000 * dim );
+
+    // uneven chunks, odd sizes split Box-Muller pairs 
+    Stream.Next ( Buffer.data(), 1 );
+    Stream.Next ( Buffer.data() + 1 * dim, 332 );
+    Stream.Next ( Buffer.data() + 333 * dim, 667 );
+
+    EXPECT_EQ ( Stream.Position(), 1000 );
+    EXPECT_EQ ( Buffer, Whole );
+
+}
+
+
+TEST ( SampleGenerator, ResumeFromSavedPosition ) {
+
+    size_t dim = 2;
+
+    Eigen::MatrixXd Correl ( 2, 2 );
+    Correl << 1.0, 0.6, 0.6, 1.0;
+
+    for ( bool Quasi : { false, true } ) {
+
+        Generator First ( dim, 8, Correl, Quasi );
+
+        std::vector<double> Expected ( 600 * dim ), Buffer ( 300 * dim );
+
+        First.Next ( Expected.data(), 600 );
+
+        // another process continues after the first 300 points 
+        Generator Resumed ( dim, 8, Correl, Quasi );
+
+        Resumed.Seek ( 300 );
+        Resumed.Next ( Buffer.data(), 300 );
+
+        for ( auto i = 0; i < Buffer.size(); i++ ) {
+
+            EXPECT_EQ ( Buffer[i], Expected[300*dim+i] );
+
+        }
+
+    }
+
+}
+
+
+TEST ( SampleGenerator, CorrelatedMoments ) {
+
+    size_t dim     = 2;
+    size_t nPoints = 1 << 14;
+
+    Eigen::MatrixXd Correl ( 2, 2 );
+    Correl << 1.0, -0.7, -0.7, 1.0;
+
+    for ( bool Quasi : { false, true } ) {
+
+        Generator Stream ( dim, 3, Correl, Quasi );
+
+        std::vector<double> Buffer ( 1024 * dim );
+
+        double Sum[2] = { 0.0, 0.0 }, Square[2] = { 0.0, 0.0 }, Cross = 0.0;
+
+        for ( auto c = 0; c < nPoints / 1024; c++ ) {
+
+            Stream.Next ( Buffer.data(), 1024 );
+
+            for ( auto i = 0; i < 1024; i++ ) {
+
+                for ( auto j = 0; j < 2; j++ ) {
+
+                    Sum   [j] += Buffer[i*dim+j];
+                    Square[j] += Buffer[i*dim+j] * Buffer[i*dim+j];
+
+                }
+
+                Cross += Buffer[i*dim] * Buffer[i*dim+1];
+
+            }
+
+        }
+
+        double Tol = Quasi ? 0.01 : 0.05;
+
+        for ( auto j = 0; j < 2; j++ ) {
+
+            EXPECT_NEAR ( Sum[j] / nPoints, 0.0, Tol );
+            EXPECT_NEAR ( Square[j] / nPoints, 1.0, Tol );
+
+        }
+
+        EXPECT_NEAR ( Cross / nPoints, -0.7, Tol );
+
+    }
+
+}
+
+
+TEST ( SampleGenerator, InvalidInputs ) {
+
+    Eigen::MatrixXd Wrong = Eigen::MatrixXd::Identity ( 3, 3 );
+
+    EXPECT_THROW ( Generator ( 0, 1 ), std::runtime_error );
+    EXPECT_THROW ( Generator ( 2, 1, Wrong ), std::runtime_error );
+    EXPECT_THROW ( Generator ( 22, 1, Eigen::MatrixXd (), true ), std::runtime_error );
+
+    Eigen::MatrixXd Indefinite ( 2, 2 );
+    Indefinite << 1.0, 2.0, 2.0, 1.0;
+
+    EXPECT_THROW ( Generator ( 2, 1, Indefinite ), std::runtime_error );
+
+}
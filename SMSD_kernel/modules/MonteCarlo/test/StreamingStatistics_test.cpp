@@ -0,0 +1,229 @@
+/**
+  * @file StreamingStatistics_test.cpp 
+  *
+  * @brief 
+  * Tests of online statistics of Monte Carlo responses 
+  *
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#include "MonteCarlo.hpp" 
+#include <gtest/gtest.h> 
+
+typedef std::complex<double> Complex;
+typedef MonteCarlo::StreamingStatistics<size_t,double,Complex> Statistics;
+
+/**
+  * @brief 
+  * Deterministic responses of two dofs, magnitudes of dof 0 are 1..nPoints 
+  */
+std::vector<Complex> MockResponses ( const size_t nPoints ) {
+
+    std::vector<Complex> Responses ( 2 * nPoints );
+
+    for ( auto i = 0; i < nPoints; i++ ) {
+
+        // shuffled order of magnitudes 
+        double x = ( 37 * i ) % nPoints + 1.0;
+
+        Responses[2*i  ] = i % 2 ? Complex ( x, 0.0 ) : Complex ( 0.0, -x );
+        Responses[2*i+1] = Complex ( std::sin ( i ), std::cos ( 2.0 * i ) );
+
+    }
+
+    return Responses;
+
+}
+
+
+TEST ( StreamingStatistics, MomentsMatchTwoPass ) {
+
+    size_t nPoints = 1000;
+
+    auto Responses = MockResponses ( nPoints );
+
+    Statistics Stats ( 2 );
+
+    // uneven chunks 
+    Stats.Add ( Responses.data(),            7 );
+    Stats.Add ( Responses.data() +  2 *   7, 500 );
+    Stats.Add ( Responses.data() +  2 * 507, nPoints - 507 );
+
+    ASSERT_EQ ( Stats.Count(), nPoints );
+
+    for ( auto j = 0; j < 2; j++ ) {
+
+        Complex Mean = 0.0;
+
+        for ( auto i = 0; i < nPoints; i++ ) Mean += Responses[2*i+j];
+
+        Mean /= double ( nPoints );
+
+        double Variance = 0.0;
+        double Min = 1e300, Max = 0.0;
+
+        for ( auto i = 0; i < nPoints; i++ ) {
+
+            Variance += std::norm ( Responses[2*i+j] - Mean );
+
+            Min = std::min ( Min, std::abs ( Responses[2*i+j] ) );
+            Max = std::max ( Max, std::abs ( Responses[2*i+j] ) );
+
+        }
+
+        Variance /= double ( nPoints - 1 );
+
+        EXPECT_NEAR ( Stats.Mean()[j].real(), Mean.real(), 1e-12 );
+        EXPECT_NEAR ( Stats.Mean()[j].imag(), Mean.imag(), 1e-12 );
+        EXPECT_NEAR ( Stats.Variance()[j], Variance, 1e-9 * Variance );
+
+        EXPECT_DOUBLE_EQ ( Stats.Min()[j], Min );
+        EXPECT_DOUBLE_EQ ( Stats.Max()[j], Max );
+
+    }
+
+}
+
+
+TEST ( StreamingStatistics, HistogramCounts ) {
+
+    size_t nPoints = 100;
+
+    auto Responses = MockResponses ( nPoints );
+
+    // edges 0, 25, 50, 75, 100, magnitude 100 is clamped to the last bin 
+    Statistics Stats ( 2, {}, 4, 0.0, 100.0 );
+
+    Stats.Add ( Responses );
+
+    auto Histogram = Stats.Histogram();
+
+    ASSERT_EQ ( Histogram.size(), 8 );
+
+    EXPECT_EQ ( Histogram[0], 24 );
+    EXPECT_EQ ( Histogram[1], 25 );
+    EXPECT_EQ ( Histogram[2], 25 );
+    EXPECT_EQ ( Histogram[3], 26 );
+
+    // dof 1 has magnitudes below 25 
+    EXPECT_EQ ( Histogram[4], nPoints );
+
+}
+
+
+TEST ( StreamingStatistics, QuantilesOfUniformMagnitudes ) {
+
+    size_t nPoints = 10000;
+
+    auto Responses = MockResponses ( nPoints );
+
+    Statistics Stats ( 2, { 0.1, 0.5, 0.9 } );
+
+    for ( auto i = 0; i < nPoints; i += 1000 ) {
+
+        Stats.Add ( Responses.data() + 2 * i, 1000 );
+
+    }
+
+    auto Quantiles = Stats.Quantiles();
+
+    ASSERT_EQ ( Quantiles.size(), 6 );
+
+    // P^2 estimates within 2 % of the range 
+    EXPECT_NEAR ( Quantiles[0], 1000.0, 200.0 );
+    EXPECT_NEAR ( Quantiles[1], 5000.0, 200.0 );
+    EXPECT_NEAR ( Quantiles[2], 9000.0, 200.0 );
+
+}
+
+
+TEST ( StreamingStatistics, MergeMatchSingleAccumulator ) {
+
+    size_t nPoints = 4000;
+
+    auto Responses = MockResponses ( nPoints );
+
+    Statistics Single ( 2, { 0.5 }, 10, 0.0, 4000.0 );
+
+    Single.Add ( Responses );
+
+    // e.g. one partial per thread 
+    std::vector<Statistics> Partials ( 
+        4, Statistics ( 2, { 0.5 }, 10, 0.0, 4000.0 ) 
+    );
+
+    for ( auto t = 0; t < 4; t++ ) {
+
+        Partials[t].Add ( Responses.data() + 2 * t * 1000, 1000 );
+
+    }
+
+    Statistics Merged ( 2, { 0.5 }, 10, 0.0, 4000.0 );
+
+    for ( auto& Partial : Partials ) Merged.Merge ( Partial );
+
+    ASSERT_EQ ( Merged.Count(), Single.Count() );
+
+    for ( auto j = 0; j < 2; j++ ) {
+
+        EXPECT_NEAR ( Merged.Mean()[j].real(), Single.Mean()[j].real(), 1e-9 );
+        EXPECT_NEAR ( Merged.Mean()[j].imag(), Single.Mean()[j].imag(), 1e-9 );
+
+        EXPECT_NEAR (
+            Merged.Variance()[j], Single.Variance()[j],
+            1e-9 * Single.Variance()[j]
+        );
+
+        EXPECT_DOUBLE_EQ ( Merged.Min()[j], Single.Min()[j] );
+        EXPECT_DOUBLE_EQ ( Merged.Max()[j], Single.Max()[j] );
+
+    }
+
+    EXPECT_EQ ( Merged.Histogram(), Single.Histogram() );
+
+    // merged P^2 markers are approximate 
+    EXPECT_NEAR ( Merged.Quantiles()[0], 2000.0, 100.0 );
+
+}
+
+
+TEST ( StreamingStatistics, MergeFewSamples ) {
+
+    std::vector<Complex> A { 1.0, 0.0, 3.0, 0.0, 5.0, 0.0 };
+    std::vector<Complex> B { 2.0, 0.0, 4.0, 0.0 };
+
+    // second accumulator is still initializing its P^2 markers 
+    Statistics First ( 1, { 0.5 } ), Right ( 1, { 0.5 } );
+
+    First.Add ( A );
+    Right.Add ( B );
+
+    First.Merge ( Right );
+
+    ASSERT_EQ ( First.Count(), 10 );
+
+    EXPECT_DOUBLE_EQ ( First.Mean()[0].real(), 1.5 );
+    EXPECT_DOUBLE_EQ ( First.Min()[0], 0.0 );
+    EXPECT_DOUBLE_EQ ( First.Max()[0], 5.0 );
+
+}
+
+
+TEST ( StreamingStatistics, InvalidInputs ) {
+
+    EXPECT_THROW ( Statistics ( 2, { 1.5 } ), std::runtime_error );
+    EXPECT_THROW ( Statistics ( 2, {}, 4, 1.0, 0.0 ), std::runtime_error );
+
+    Statistics Stats ( 2 );
+
+    std::vector<Complex> Odd ( 3 );
+
+    EXPECT_THROW ( Stats.Add ( Odd ), std::runtime_error );
+
+    Statistics Other ( 3 );
+
+    EXPECT_THROW ( Stats.Merge ( Other ), std::runtime_error );
+
+}
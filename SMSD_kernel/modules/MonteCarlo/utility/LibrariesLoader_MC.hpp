@@ -13,15 +13,21 @@
 #define LIBRARIES_LOADER_MC 
 
 #include <algorithm> 
+#include <array> 
 #include <cmath> 
 #include <complex> 
+#include <cstdint> 
 #include <functional> 
+#include <limits> 
 #include <numeric> 
 #include <random>
 #include <stdexcept> 
+#include <utility> 
 #include <vector>
 
+#include <boost/math/constants/constants.hpp> 
 #include <boost/math/distributions.hpp> 
+#include <boost/math/tools/roots.hpp> 
 #include <Eigen/Dense> 
 
 #endif // LIBRARIES_LOADER_MC 
@@ -0,0 +1,283 @@
+/**
+  * @file IntrusivePCE_test.cpp 
+  * 
+  * @brief 
+  * Tests of intrusive PCE model of Mass-Spring-Damper system 
+  * 
+  * @author 
+  * Rezha Adrian Tanuharja @n 
+  * Contact: rezha.tanuharja@tum.de / rezhadr@outlook.com 
+  */
+
+#include "Surrogate_MassSpringDamper.hpp" 
+#include <gtest/gtest.h> 
+
+using namespace MassSpringDamper::Surrogate;
+
+/**
+  * @brief 
+  * Deterministic solution A^-1 f of the model at omega 
+  */
+VectorC Solve ( 
+    const AnalyticalModel& SDModel, const R omega, const VectorC& f 
+) {
+
+    auto n = SDModel.Dim();
+
+    auto DynamicStiffness = SDModel.DynamicStiffness ( omega );
+
+    Eigen::Map<MatrixXC> A ( DynamicStiffness.data(), n, n );
+    Eigen::Map<const VectorXC> b ( f.data(), n );
+
+    VectorC result ( n );
+
+    Eigen::Map<VectorXC> ( result.data(), n ) = A.partialPivLu().solve ( b );
+
+    return result;
+
+}
+
+/**
+  * @brief 
+  * Position of a set of indices within the basis of given dimension 
+  */
+Z BasisPosition ( const VectorZ& Indices, const VectorZ& Set ) {
+
+    auto Dim = Set.size();
+
+    for ( auto k = 0; k < Indices.size() / Dim; k++ ) {
+
+        auto First = Indices.begin() + k * Dim;
+
+        if ( std::equal ( Set.begin(), Set.end(), First ) ) return k;
+
+    }
+
+    throw std::runtime_error ( "BasisPosition: set not found" );
+
+}
+
+
+TEST ( IntrusivePCE, StatisticsOfAdditiveRandomLoad ) {
+
+    AnalyticalModel SDModel ( 
+        { 1.0, 1.2, 0.8 }, { 0.3, 0.2, 0.4 }, { 40.0, 25.0, 30.0 } 
+    );
+
+    R omega = 3.0;
+    Z n = 3, Dim = 2, MaxSum = 3;
+
+    // same basis as SetIndices ( MaxSum, MaxSum ) 
+    auto Indices = BasisFunctions::MultiIndex<size_t> ( Dim, MaxSum );
+    BasisFunctions::TotalTruncation<size_t> ( Indices, Dim, MaxSum );
+
+    auto nBasis = Indices.size() / Dim;
+
+    // random load is linear in H_1(x1), H_2(x1) and H_1(x2), no interaction 
+    VectorC fa { 1.0, 0.0, 0.5 };
+    VectorC fb { 0.0, C ( 0.0, 0.3 ), 0.0 };
+    VectorC fc { 0.2, 0.2, 0.0 };
+
+    VectorC Load { 1.0, 0.0, 2.0 };
+    VectorC ForceBasisCoeffs ( n * nBasis, 0.0 );
+
+    auto Place = [&]( const VectorZ& Set, const VectorC& f ) {
+
+        auto k = BasisPosition ( Indices, Set );
+
+        std::copy ( f.begin(), f.end(), ForceBasisCoeffs.begin() + k * n );
+
+    };
+
+    Place ( { 1, 0 }, fa );
+    Place ( { 2, 0 }, fb );
+    Place ( { 0, 1 }, fc );
+
+    IntrusivePCE iPCE ( &SDModel, omega, Dim );
+
+    iPCE.SetIndices ( MaxSum, MaxSum );
+    iPCE.Train ( Load, {}, {}, {}, ForceBasisCoeffs );
+
+    // response is linear in the load, so the expansion is exact 
+    auto Mean = Solve ( SDModel, omega, Load );
+    auto ua   = Solve ( SDModel, omega, fa );
+    auto ub   = Solve ( SDModel, omega, fb );
+    auto uc   = Solve ( SDModel, omega, fc );
+
+    auto [ mean, variance ] = iPCE.Statistics();
+
+    auto First = iPCE.SensitivityIndices ();
+    auto Total = iPCE.SensitivityIndices ( true );
+
+    ASSERT_EQ ( First.size(), n * Dim );
+
+    for ( auto j = 0; j < n; j++ ) {
+
+        R V1 = std::norm ( ua[j] ) + std::norm ( ub[j] );
+        R V2 = std::norm ( uc[j] );
+
+        EXPECT_NEAR ( 
+            std::abs ( mean[j] - Mean[j] ), 0.0, 1e-12 * std::abs ( Mean[j] ) 
+        );
+        EXPECT_NEAR ( variance[j], V1 + V2, 1e-12 * ( V1 + V2 ) );
+
+        EXPECT_NEAR ( First[j  ], V1 / ( V1 + V2 ), 1e-12 );
+        EXPECT_NEAR ( First[j+n], V2 / ( V1 + V2 ), 1e-12 );
+
+        // without interaction first order and total indices coincide 
+        EXPECT_NEAR ( Total[j  ], First[j  ], 1e-12 );
+        EXPECT_NEAR ( Total[j+n], First[j+n], 1e-12 );
+
+    }
+
+    // an interaction term H_1(x1) H_1(x2) only enters the total indices 
+    Place ( { 1, 1 }, fc );
+
+    iPCE.Train ( Load, {}, {}, {}, ForceBasisCoeffs );
+
+    First = iPCE.SensitivityIndices ();
+    Total = iPCE.SensitivityIndices ( true );
+
+    for ( auto j = 0; j < n; j++ ) {
+
+        R V1 = std::norm ( ua[j] ) + std::norm ( ub[j] );
+        R V2 = std::norm ( uc[j] );
+        R V  = V1 + 2.0 * V2;
+
+        EXPECT_NEAR ( First[j  ], V1 / V, 1e-12 );
+        EXPECT_NEAR ( First[j+n], V2 / V, 1e-12 );
+
+        EXPECT_NEAR ( Total[j  ], ( V1 + V2 ) / V, 1e-12 );
+        EXPECT_NEAR ( Total[j+n], 2.0 * V2 / V, 1e-12 );
+
+    }
+
+}
+
+
+TEST ( IntrusivePCE, TrainSweepMatchTrain ) {
+
+    AnalyticalModel SDModel ( 
+        { 1.0, 1.0, 1.5 }, { 1.0, 0.5, 0.3 }, { 20.0, 10.0, 15.0 } 
+    );
+
+    Z Dim = 2;
+
+    // random parts on the first two basis functions of 3 dofs 
+    VectorR MassBasisCoeffs   { 0, 0, 0, 0.05, 0.0, 0.02, 0.0, 0.03, 0.0 };
+    VectorR DamperBasisCoeffs { 0, 0, 0, 0.01, 0.0, 0.0,  0.0, 0.0, 0.02 };
+    VectorR SpringBasisCoeffs { 0, 0, 0, 1.0,  0.5, 0.0,  0.0, 0.7, 1.2  };
+
+    VectorC ForceBasisCoeffs { 0.1, 0.0, 0.0, 0.0, 0.2, 0.0 };
+    VectorC Load { 1.0, 1.0, 1.0 };
+
+    VectorR Omegas;
+
+    for ( auto w = 0; w < 12; w++ ) Omegas.push_back ( 0.5 + 0.5 * w );
+
+    VectorR X { 0.3, -0.2, 1.1, 0.4, -0.7, 0.9 };
+
+    for ( auto Solver : { 
+        GalerkinSolver::DenseLU, 
+        GalerkinSolver::SparseLU, 
+        GalerkinSolver::MatrixFree 
+    } ) {
+    for ( bool WarmStart : { false, true } ) {
+
+        IntrusivePCE Sweep ( &SDModel, 0.0, Dim );
+
+        Sweep.SetIndices ( 4, 4 );
+        Sweep.SetSolver ( Solver );
+        Sweep.SetTolerance ( 1e-12, 1000 );
+
+        Sweep.TrainSweep ( 
+            Omegas, Load, 
+            MassBasisCoeffs, DamperBasisCoeffs, SpringBasisCoeffs, 
+            ForceBasisCoeffs, WarmStart 
+        );
+
+        ASSERT_EQ ( Sweep.Frequencies(), Omegas );
+
+        // BiCGSTAB from another start stops at another iterate 
+        R Tolerance = 
+            Solver == GalerkinSolver::MatrixFree && WarmStart ? 1e-9 : 1e-12;
+
+        for ( auto w = 0; w < Omegas.size(); w++ ) {
+
+            IntrusivePCE Single ( &SDModel, Omegas[w], Dim );
+
+            Single.SetIndices ( 4, 4 );
+            Single.SetSolver ( Solver );
+            Single.SetTolerance ( 1e-12, 1000 );
+
+            Single.Train ( 
+                Load, 
+                MassBasisCoeffs, DamperBasisCoeffs, SpringBasisCoeffs, 
+                ForceBasisCoeffs 
+            );
+
+            Sweep.SelectFrequency ( w );
+
+            auto Expected = Single.ComputeResponse ( X );
+            auto Result   = Sweep .ComputeResponse ( X );
+
+            ASSERT_EQ ( Result.size(), Expected.size() );
+
+            for ( auto i = 0; i < Result.size(); i++ ) {
+
+                EXPECT_NEAR ( 
+                    std::abs ( Result[i] - Expected[i] ), 0.0, 
+                    Tolerance * std::abs ( Expected[i] ) 
+                );
+
+            }
+
+        }
+
+    }
+    }
+
+}
+
+
+TEST ( IntrusivePCE, SelectFrequencyInvalidState ) {
+
+    AnalyticalModel SDModel ( { 1.0, 1.0 }, { 0.1, 0.1 }, { 10.0, 10.0 } );
+
+    IntrusivePCE iPCE ( &SDModel, 1.0, 1 );
+
+    iPCE.SetIndices ( 2, 2 );
+
+    // no sweep trained yet 
+    EXPECT_THROW ( iPCE.SelectFrequency ( 0 ), std::runtime_error );
+
+    VectorC Load { 1.0, 0.0 };
+
+    iPCE.TrainSweep ( { 1.0, 2.0 }, Load, {}, {}, {}, {} );
+
+    EXPECT_EQ ( iPCE.Frequencies().size(), 2 );
+    EXPECT_THROW ( iPCE.SelectFrequency ( 2 ), std::runtime_error );
+
+    iPCE.SelectFrequency ( 1 );
+
+    // a new single-frequency training discards the sweep 
+    iPCE.Train ( Load, {}, {}, {}, {} );
+
+    EXPECT_TRUE ( iPCE.Frequencies().empty() );
+    EXPECT_THROW ( iPCE.SelectFrequency ( 0 ), std::runtime_error );
+
+    // and still trains at the angular velocity of the constructor 
+    IntrusivePCE Fresh ( &SDModel, 1.0, 1 );
+
+    Fresh.SetIndices ( 2, 2 );
+    Fresh.Train ( Load, {}, {}, {}, {} );
+
+    VectorR X { 0.3, -1.2 };
+
+    EXPECT_EQ ( iPCE.ComputeResponse ( X ), Fresh.ComputeResponse ( X ) );
+
+    EXPECT_THROW ( 
+        iPCE.TrainSweep ( {}, Load, {}, {}, {}, {} ), std::runtime_error 
+    );
+
+}
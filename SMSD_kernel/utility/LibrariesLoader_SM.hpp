@@ -17,7 +17,15 @@
 #include <functional> 
 #include <iostream> 
 #include <stdexcept> 
+#include <type_traits> 
+#include <utility> 
 #include <vector> 
 
+#include <Eigen/Sparse> 
+
+#ifdef _OPENMP 
+    #include <omp.h> 
+#endif 
+
 #endif // LIBRARIES_LOADER_SM 
 
@@ -11,12 +11,72 @@ typedef std::complex<R> C;
 typedef std::vector<R> VectorR;
 typedef std::vector<C> VectorC;
 
+typedef MassSpringDamper::Surrogate::StreamingStatistics Statistics;
+
 
 PYBIND11_MODULE ( SMSD, m ) {
 
     m.doc() = "Surrogate Model for Mass Spring Damper System";
 
-    m.def ( "RandomSampling", &MonteCarlo::RandomSampling<Z,R,C> );
+    m.def ( 
+        "RandomSampling", 
+        pybind11::overload_cast< const Z, const Z > 
+        ( &MonteCarlo::RandomSampling<Z,R,C> ) 
+    );
+
+    m.def ( 
+        "RandomSampling", 
+        pybind11::overload_cast< const Z, const Z, const std::uint64_t, const Z > 
+        ( &MonteCarlo::RandomSampling<Z,R,C> ), 
+        pybind11::arg ( "nPoints" ), 
+        pybind11::arg ( "dim" ), 
+        pybind11::arg ( "Seed" ), 
+        pybind11::arg ( "FirstPoint" ) = 0 
+    );
+
+    m.def ( 
+        "RandomSamplingReal", 
+        pybind11::overload_cast< const Z, const Z > 
+        ( &MonteCarlo::RandomSampling<Z,R,R> ) 
+    );
+
+    m.def ( 
+        "RandomSamplingReal", 
+        pybind11::overload_cast< const Z, const Z, const std::uint64_t, const Z > 
+        ( &MonteCarlo::RandomSampling<Z,R,R> ), 
+        pybind11::arg ( "nPoints" ), 
+        pybind11::arg ( "dim" ), 
+        pybind11::arg ( "Seed" ), 
+        pybind11::arg ( "FirstPoint" ) = 0 
+    );
+
+    pybind11::class_ < Statistics > 
+    ( m, "StreamingStatistics" ) 
+
+        .def ( 
+
+            pybind11::init< const Z, const VectorR&, const Z, const R, const R > (), 
+            pybind11::arg ( "nDOFs" ), 
+            pybind11::arg ( "Probabilities" ) = VectorR (), 
+            pybind11::arg ( "nBins" ) = 0, 
+            pybind11::arg ( "Lower" ) = 0.0, 
+            pybind11::arg ( "Upper" ) = 1.0 
+
+        ) 
+
+        .def ( 
+            "Add", 
+            pybind11::overload_cast< const VectorC& > ( &Statistics::Add ) 
+        ) 
+
+        .def ( "Merge",      &Statistics::Merge ) 
+        .def ( "Count",      &Statistics::Count ) 
+        .def ( "Mean",       &Statistics::Mean ) 
+        .def ( "Variance",   &Statistics::Variance ) 
+        .def ( "Min",        &Statistics::Min ) 
+        .def ( "Max",        &Statistics::Max ) 
+        .def ( "Histogram",  &Statistics::Histogram ) 
+        .def ( "Quantiles",  &Statistics::Quantiles ); 
 
     pybind11::class_ < Analytical::MassSpringDamper<Z,R,C> > 
     ( m, "MassSpringDamper" ) 
@@ -27,6 +87,60 @@ PYBIND11_MODULE ( SMSD, m ) {
                             const VectorR&, 
                             const VectorR& > () 
 
+        ) 
+
+        .def ( 
+
+            "FrequencySweep", 
+            pybind11::overload_cast< const VectorC&, const VectorR&, const Z > 
+            ( 
+                &Analytical::MassSpringDamper<Z,R,C>::FrequencySweep, 
+                pybind11::const_ 
+            ), 
+            pybind11::arg ( "Force" ), 
+            pybind11::arg ( "Omegas" ), 
+            pybind11::arg ( "Threads" ) = 0, 
+            "responses { Omega1 of all dofs, Omega2 of all dofs, ... }"
+
+        ); 
+
+    pybind11::enum_< Analytical::ModalDamping > 
+    ( m, "ModalDamping" ) 
+
+        .value ( 
+            "Proportional", Analytical::ModalDamping::Proportional 
+        ) 
+
+        .value ( 
+            "NonProportional", Analytical::ModalDamping::NonProportional 
+        ); 
+
+    pybind11::class_ < Analytical::ModalSolver<Z,R,C> > 
+    ( m, "ModalSolver" ) 
+
+        .def ( 
+
+            pybind11::init< const Analytical::MassSpringDamper<Z,R,C>&, 
+                            const Z, 
+                            const Analytical::ModalDamping > (), 
+            pybind11::arg ( "Model" ), 
+            pybind11::arg ( "nModes" ) = 0, 
+            pybind11::arg ( "Damping" ) = Analytical::ModalDamping::Proportional 
+
+        ) 
+
+        .def ( "nModes",          &Analytical::ModalSolver<Z,R,C>::nModes ) 
+        .def ( "Frequencies",     &Analytical::ModalSolver<Z,R,C>::Frequencies ) 
+        .def ( "ComputeResponse", &Analytical::ModalSolver<Z,R,C>::ComputeResponse ) 
+
+        .def ( 
+
+            "FrequencySweep", 
+            &Analytical::ModalSolver<Z,R,C>::FrequencySweep, 
+            pybind11::arg ( "Force" ), 
+            pybind11::arg ( "Omegas" ), 
+            pybind11::arg ( "Threads" ) = 0 
+
         ); 
 
     pybind11::class_ < MassSpringDamper::Surrogate::DirectMCS >
@@ -50,14 +164,115 @@ PYBIND11_MODULE ( SMSD, m ) {
 
         )
 
+        .def (
+
+            "SetBatchSize", 
+            &MassSpringDamper::Surrogate::DirectMCS::SetBatchSize, 
+            "samples per batch of tridiagonal solver, 0 for per sample"
+
+        )
+
+        .def (
+
+            "SetThreads", 
+            &MassSpringDamper::Surrogate::DirectMCS::SetThreads, 
+            "number of OpenMP threads, 0 for all available"
+
+        )
+
+        .def (
+
+            "SetTileSize", 
+            &MassSpringDamper::Surrogate::DirectMCS::SetTileSize, 
+            "points per tile in AccumulateResponse, 0 for a single tile"
+
+        )
+
+        .def (
+
+            "AccumulateResponse", 
+            pybind11::overload_cast< const VectorR&, 
+                                     const VectorC&, 
+                                     const VectorR&, 
+                                     const VectorR&, 
+                                     const VectorR&, 
+                                     const VectorC&, 
+                                     Statistics& > 
+            ( 
+                &MassSpringDamper::Surrogate::DirectMCS::AccumulateResponse, 
+                pybind11::const_ 
+            ), 
+            "real random inputs"
+
+        )
+
+        .def (
+
+            "AccumulateResponse", 
+            pybind11::overload_cast< const VectorC&, 
+                                     const VectorC&, 
+                                     const VectorR&, 
+                                     const VectorR&, 
+                                     const VectorR&, 
+                                     const VectorC&, 
+                                     Statistics& > 
+            ( 
+                &MassSpringDamper::Surrogate::DirectMCS::AccumulateResponse, 
+                pybind11::const_ 
+            ), 
+            "feed responses into streaming statistics"
+
+        )
+
+        .def (
+
+            "ComputeResponse", 
+            pybind11::overload_cast< const VectorR&, 
+                                     const VectorC&, 
+                                     const VectorR&, 
+                                     const VectorR&, 
+                                     const VectorR&, 
+                                     const VectorC& > 
+            ( 
+                &MassSpringDamper::Surrogate::DirectMCS::ComputeResponse, 
+                pybind11::const_ 
+            ), 
+            "real random inputs"
+
+        )
+
         .def (
 
             "ComputeResponse", 
-            &MassSpringDamper::Surrogate::DirectMCS::ComputeResponse, 
+            pybind11::overload_cast< const VectorC&, 
+                                     const VectorC&, 
+                                     const VectorR&, 
+                                     const VectorR&, 
+                                     const VectorR&, 
+                                     const VectorC& > 
+            ( 
+                &MassSpringDamper::Surrogate::DirectMCS::ComputeResponse, 
+                pybind11::const_ 
+            ), 
             "something"
 
         );
 
+    pybind11::enum_< MassSpringDamper::Surrogate::GalerkinSolver > 
+    ( m, "GalerkinSolver" ) 
+
+        .value ( 
+            "DenseLU", MassSpringDamper::Surrogate::GalerkinSolver::DenseLU 
+        ) 
+
+        .value ( 
+            "SparseLU", MassSpringDamper::Surrogate::GalerkinSolver::SparseLU 
+        ) 
+
+        .value ( 
+            "MatrixFree", MassSpringDamper::Surrogate::GalerkinSolver::MatrixFree 
+        ); 
+
     pybind11::class_< MassSpringDamper::Surrogate::IntrusivePCE > 
     ( m, "IntrusivePCE" )
 
@@ -77,20 +292,128 @@ PYBIND11_MODULE ( SMSD, m ) {
 
         )
 
+        .def (
+
+            "SetSolver", 
+            &MassSpringDamper::Surrogate::IntrusivePCE::SetSolver, 
+            "choose DenseLU, SparseLU or MatrixFree Galerkin solver"
+
+        )
+
+        .def (
+
+            "SetTolerance", 
+            &MassSpringDamper::Surrogate::IntrusivePCE::SetTolerance, 
+            "stopping criteria of matrix-free solver"
+
+        )
+
+        .def (
+
+            "SetTileSize", 
+            &MassSpringDamper::Surrogate::IntrusivePCE::SetTileSize, 
+            "points per tile in ComputeResponse, 0 for a single tile"
+
+        )
+
+        .def (
+
+            "ComputeResponse", 
+            pybind11::overload_cast< const VectorR& > ( 
+                &MassSpringDamper::Surrogate::IntrusivePCE::ComputeResponse, 
+                pybind11::const_ 
+            ), 
+            "real random inputs"
+
+        ) 
+
         .def (
 
             "ComputeResponse", 
-            &MassSpringDamper::Surrogate::IntrusivePCE::ComputeResponse, 
+            pybind11::overload_cast< const VectorC& > ( 
+                &MassSpringDamper::Surrogate::IntrusivePCE::ComputeResponse, 
+                pybind11::const_ 
+            ), 
             "something"
 
         ) 
 
+        .def (
+
+            "AccumulateResponse", 
+            pybind11::overload_cast< const VectorR&, Statistics& > ( 
+                &MassSpringDamper::Surrogate::IntrusivePCE::AccumulateResponse, 
+                pybind11::const_ 
+            ), 
+            "real random inputs"
+
+        ) 
+
+        .def (
+
+            "AccumulateResponse", 
+            pybind11::overload_cast< const VectorC&, Statistics& > ( 
+                &MassSpringDamper::Surrogate::IntrusivePCE::AccumulateResponse, 
+                pybind11::const_ 
+            ), 
+            "feed responses into streaming statistics"
+
+        ) 
+
+        .def (
+
+            "Statistics", 
+            &MassSpringDamper::Surrogate::IntrusivePCE::Statistics, 
+            "closed-form mean and variance per dof"
+
+        ) 
+
+        .def (
+
+            "SensitivityIndices", 
+            &MassSpringDamper::Surrogate::IntrusivePCE::SensitivityIndices, 
+            "first order or total Sobol indices per input and dof", 
+            pybind11::arg ( "Total" ) = false 
+
+        ) 
+
         .def (
 
             "Train", 
             &MassSpringDamper::Surrogate::IntrusivePCE::Train, 
             "something"
 
+        )
+
+        .def (
+
+            "TrainSweep", 
+            &MassSpringDamper::Surrogate::IntrusivePCE::TrainSweep, 
+            "train at several angular velocities with shared operators", 
+            pybind11::arg ( "Omegas" ), 
+            pybind11::arg ( "Load" ), 
+            pybind11::arg ( "MassBasisCoeffs" ), 
+            pybind11::arg ( "DamperBasisCoeffs" ), 
+            pybind11::arg ( "SpringBasisCoeffs" ), 
+            pybind11::arg ( "ForceBasisCoeffs" ), 
+            pybind11::arg ( "WarmStart" ) = false 
+
+        )
+
+        .def (
+
+            "SelectFrequency", 
+            &MassSpringDamper::Surrogate::IntrusivePCE::SelectFrequency, 
+            "use coefficients of one frequency of the last sweep"
+
+        )
+
+        .def (
+
+            "Frequencies", 
+            &MassSpringDamper::Surrogate::IntrusivePCE::Frequencies, 
+            "angular velocities of the last sweep"
+
         );
 
 } 